@@ -16,6 +16,7 @@
 
 #include "mozzi_utils.h"
 #include "meta.h"
+#include "mozzi_profile.h"
 
 enum interpolation_types {LINEAR,ALLPASS};
 
@@ -70,6 +71,7 @@ public:
 	inline
 	int16_t next(int8_t input)
 	{
+		MOZZI_PROFILE_SCOPE("AudioDelayFeedback::next");
 		// chooses a different next() function depending on whether the
 		// the template parameter is LINEAR(default if none provided) or ALLPASS.
 		// See meta.h.
@@ -82,11 +84,12 @@ public:
 	@param input the signal input.
 	@param delaytime_cells indicates the delay time in terms of cells in the delay buffer.
 	It doesn't change the stored internal value of _delaytime_cells.
-	@note Timing: 4us
+	@note To measure the cost of this on your board, see @ref MOZZI_PROFILER.
 	*/
 	inline
 	int16_t next(int8_t input, uint16_t delaytime_cells)
 	{
+		MOZZI_PROFILE_SCOPE("AudioDelayFeedback::next");
 		//setPin13High();
 		++write_pos &= (NUM_BUFFER_SAMPLES - 1);
 		uint16_t read_pos = (write_pos - delaytime_cells) & (NUM_BUFFER_SAMPLES - 1);
@@ -112,6 +115,7 @@ public:
 	inline
 	int16_t next(int8_t input, Q16n16 delaytime_cells)
 	{
+		MOZZI_PROFILE_SCOPE("AudioDelayFeedback::next");
 		//setPin13High();
 		++write_pos &= (NUM_BUFFER_SAMPLES - 1);
 
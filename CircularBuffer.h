@@ -16,21 +16,26 @@ On 18 April 2014, the simplified version on the Wikipedia page for power of 2 si
 doesn't work - cbIsEmpty() returns true whether the buffer is full or empty.
 */
 
-#define MOZZI_BUFFER_SIZE 256 // do not expect to change and it to work.
-                              // just here for forward compatibility if one day
-                              // the buffer size might be editable
+#include "IntegerType.h"
 
-/** Circular buffer object.  Has a fixed number of cells, set to 256.
+#define MOZZI_BUFFER_SIZE 256 // default number of cells. The size of Mozzi's output buffer is configured using MOZZI_OUTPUT_BUFFER_SIZE.
+
+/** Circular buffer object.  Has a fixed number of cells, 256 by default.
 @tparam ITEM_TYPE the kind of data to store, eg. int, int8_t etc.
+@tparam NUM_ITEMS the number of cells. Must be a power of two, between 2 and 32768.
 */
-template <class ITEM_TYPE>
+template <class ITEM_TYPE, uint16_t NUM_ITEMS = MOZZI_BUFFER_SIZE>
 class CircularBuffer
 {
+	static_assert((NUM_ITEMS & (NUM_ITEMS - 1)) == 0 && NUM_ITEMS > 1, "Size of CircularBuffer must be a power of two");
+	// For the default size of 256, a byte-sized index wraps around, naturally, so the masking in cbIncrStart() and cbIncrEnd() compiles to nothing.
+	// Larger sizes need 16 bit indices, which are not accessed atomically on 8 bit platforms (hence MOZZI_OUTPUT_BUFFER_SIZE is limited to 256 on AVR).
+	typedef typename IntegerType<(NUM_ITEMS > 256) ? 2 : 1>::unsigned_type index_t;
 
 public:
 	/** Constructor
 	*/
-	CircularBuffer(): start(0),end(0),s_msb(0),e_msb(0)
+	CircularBuffer(): start(0),end(0),s_msb(0),e_msb(0),num_buffers_read(0)
 	{
 	}
 
@@ -58,9 +63,47 @@ public:
 		return out;
 	}
 
+	/** Number of items that can be written before the buffer is full */
+	inline
+	uint16_t freeSpace() {
+		if (isFull()) return 0;
+		return NUM_ITEMS - ((end - start) & (NUM_ITEMS - 1));
+	}
+
+	/** Number of items waiting to be read */
+	inline
+	uint16_t available() {
+		if (isFull()) return NUM_ITEMS;
+		return (end - start) & (NUM_ITEMS - 1);
+	}
+
+	/** Number of items that can be written to writeAddress() in one go, i.e. without wrapping around the end of the buffer */
+	inline
+	uint16_t contiguousFreeSpace() {
+		if (e_msb == s_msb) return NUM_ITEMS - end;
+		return start - end;
+	}
+
+	/** Address of the next item to be written. Use together with contiguousFreeSpace() and advanceWrite() to write several items directly into the buffer */
+	inline
+	ITEM_TYPE * writeAddress() {
+		return items + end;
+	}
+
+	/** Mark n items, written at writeAddress(), as filled. n must not exceed contiguousFreeSpace() */
+	inline
+	void advanceWrite(uint16_t n) {
+		uint16_t new_end = end + n;
+		if (new_end >= NUM_ITEMS) {
+			e_msb ^= 1;
+			new_end -= NUM_ITEMS;
+		}
+		end = new_end;
+	}
+
 	inline
 	unsigned long count() {
-		return (num_buffers_read << 8) + start;
+		return (num_buffers_read * NUM_ITEMS) + start;
 	}
         inline
 	ITEM_TYPE * address() {
@@ -68,9 +111,9 @@ public:
 	}
 
 private:
-	ITEM_TYPE items[MOZZI_BUFFER_SIZE];
-	uint8_t         start;  /* index of oldest itement              */
-	uint8_t         end;    /* index at which to write new itement  */
+	ITEM_TYPE items[NUM_ITEMS];
+	index_t         start;  /* index of oldest itement              */
+	index_t         end;    /* index at which to write new itement  */
 	uint8_t         s_msb;
 	uint8_t         e_msb;
 	unsigned long num_buffers_read;
@@ -78,7 +121,7 @@ private:
 
 	inline
 	void cbIncrStart() {
-		start++;
+		start = (start + 1) & (NUM_ITEMS - 1);
 		if (start == 0) {
 			s_msb ^= 1;
 			num_buffers_read++;
@@ -87,7 +130,7 @@ private:
 
 	inline
 	void cbIncrEnd() {
-		end++;
+		end = (end + 1) & (NUM_ITEMS - 1);
 		if (end == 0) e_msb ^= 1;
 	}
 
@@ -0,0 +1,352 @@
+/*
+ * FMVoice.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef FMVOICE_H_
+#define FMVOICE_H_
+
+#include "Arduino.h"
+#include "Oscil.h"
+
+namespace MozziPrivate {
+/* Routing of the FM algorithms, numbered as on the Yamaha DX7 (6 operators, algorithms 1 to 32) and DX21/DX100/TX81Z
+ * (4 operators, algorithms 1 to 8). Operators are numbered 1 to OPS in the masks below, as in the manuals, i.e. bit (n-1) is operator n.
+ * MODULATORS has one byte per operator (operator 1 in the lowest byte): the operators modulating it. Modulators always have higher
+ * numbers than the operators they modulate. CARRIERS are the operators heard at the output. Feedback goes from the output of
+ * FEEDBACK_SRC to the input of FEEDBACK_DST (the same operator, except for DX7 algorithms 4 and 6). */
+template <uint8_t OPS, uint8_t ALGORITHM> struct FMAlgorithm
+{
+	static const bool VALID = false;
+};
+
+#define MOZZI__FM_OP(n) (1u << ((n) - 1))
+#define MOZZI__FM_ALGORITHM(ops, algorithm, carriers, feedback_src, feedback_dst, m1, m2, m3, m4, m5, m6) \
+template <> struct FMAlgorithm<ops, algorithm> \
+{ \
+	static const bool VALID = true; \
+	static const uint64_t MODULATORS = (uint64_t) (m1) | ((uint64_t) (m2) << 8) | ((uint64_t) (m3) << 16) | ((uint64_t) (m4) << 24) | ((uint64_t) (m5) << 32) | ((uint64_t) (m6) << 40); \
+	static const uint8_t CARRIERS = carriers; \
+	static const uint8_t FEEDBACK_SRC = feedback_src - 1; \
+	static const uint8_t FEEDBACK_DST = feedback_dst - 1; \
+}
+
+// 4 operators (DX21, DX100, TX81Z)
+MOZZI__FM_ALGORITHM(4, 1, MOZZI__FM_OP(1), 4, 4, MOZZI__FM_OP(2), MOZZI__FM_OP(3), MOZZI__FM_OP(4), 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 2, MOZZI__FM_OP(1), 4, 4, MOZZI__FM_OP(2), MOZZI__FM_OP(3) | MOZZI__FM_OP(4), 0, 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 3, MOZZI__FM_OP(1), 4, 4, MOZZI__FM_OP(2) | MOZZI__FM_OP(4), MOZZI__FM_OP(3), 0, 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 4, MOZZI__FM_OP(1), 4, 4, MOZZI__FM_OP(2) | MOZZI__FM_OP(3), 0, MOZZI__FM_OP(4), 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 5, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 4, 4, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 6, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(3), 4, 4, MOZZI__FM_OP(4), MOZZI__FM_OP(4), MOZZI__FM_OP(4), 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 7, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(3), 4, 4, 0, 0, MOZZI__FM_OP(4), 0, 0, 0);
+MOZZI__FM_ALGORITHM(4, 8, 0x0F, 4, 4, 0, 0, 0, 0, 0, 0);
+
+// 6 operators (DX7)
+MOZZI__FM_ALGORITHM(6, 1, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 6, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), MOZZI__FM_OP(5), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 2, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 2, 2, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), MOZZI__FM_OP(5), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 3, MOZZI__FM_OP(1) | MOZZI__FM_OP(4), 6, 6, MOZZI__FM_OP(2), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 4, MOZZI__FM_OP(1) | MOZZI__FM_OP(4), 4, 6, MOZZI__FM_OP(2), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 5, MOZZI__FM_OP(1) | MOZZI__FM_OP(3) | MOZZI__FM_OP(5), 6, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 6, MOZZI__FM_OP(1) | MOZZI__FM_OP(3) | MOZZI__FM_OP(5), 5, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 7, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 6, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 8, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 4, 4, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 9, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 2, 2, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 10, MOZZI__FM_OP(1) | MOZZI__FM_OP(4), 3, 3, MOZZI__FM_OP(2), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 11, MOZZI__FM_OP(1) | MOZZI__FM_OP(4), 6, 6, MOZZI__FM_OP(2), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 12, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 2, 2, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4) | MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0, 0);
+MOZZI__FM_ALGORITHM(6, 13, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 6, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4) | MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0, 0);
+MOZZI__FM_ALGORITHM(6, 14, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 6, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 15, MOZZI__FM_OP(1) | MOZZI__FM_OP(3), 2, 2, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 16, MOZZI__FM_OP(1), 6, 6, MOZZI__FM_OP(2) | MOZZI__FM_OP(3) | MOZZI__FM_OP(5), 0, MOZZI__FM_OP(4), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 17, MOZZI__FM_OP(1), 2, 2, MOZZI__FM_OP(2) | MOZZI__FM_OP(3) | MOZZI__FM_OP(5), 0, MOZZI__FM_OP(4), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 18, MOZZI__FM_OP(1), 3, 3, MOZZI__FM_OP(2) | MOZZI__FM_OP(3) | MOZZI__FM_OP(4), 0, 0, MOZZI__FM_OP(5), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 19, MOZZI__FM_OP(1) | MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 6, 6, MOZZI__FM_OP(2), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(6), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 20, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(4), 3, 3, MOZZI__FM_OP(3), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 21, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 3, 3, MOZZI__FM_OP(3), MOZZI__FM_OP(3), 0, MOZZI__FM_OP(6), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 22, MOZZI__FM_OP(1) | MOZZI__FM_OP(3) | MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 6, 6, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(6), MOZZI__FM_OP(6), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 23, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(4) | MOZZI__FM_OP(5), 6, 6, 0, MOZZI__FM_OP(3), 0, MOZZI__FM_OP(6), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 24, 0x1F, 6, 6, 0, 0, MOZZI__FM_OP(6), MOZZI__FM_OP(6), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 25, 0x1F, 6, 6, 0, 0, 0, MOZZI__FM_OP(6), MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 26, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(4), 6, 6, 0, MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 27, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(4), 3, 3, 0, MOZZI__FM_OP(3), 0, MOZZI__FM_OP(5) | MOZZI__FM_OP(6), 0, 0);
+MOZZI__FM_ALGORITHM(6, 28, MOZZI__FM_OP(1) | MOZZI__FM_OP(3) | MOZZI__FM_OP(6), 5, 5, MOZZI__FM_OP(2), 0, MOZZI__FM_OP(4), MOZZI__FM_OP(5), 0, 0);
+MOZZI__FM_ALGORITHM(6, 29, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(3) | MOZZI__FM_OP(5), 6, 6, 0, 0, MOZZI__FM_OP(4), 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 30, MOZZI__FM_OP(1) | MOZZI__FM_OP(2) | MOZZI__FM_OP(3) | MOZZI__FM_OP(6), 5, 5, 0, 0, MOZZI__FM_OP(4), MOZZI__FM_OP(5), 0, 0);
+MOZZI__FM_ALGORITHM(6, 31, 0x1F, 6, 6, 0, 0, 0, 0, MOZZI__FM_OP(6), 0);
+MOZZI__FM_ALGORITHM(6, 32, 0x3F, 6, 6, 0, 0, 0, 0, 0, 0);
+
+#undef MOZZI__FM_ALGORITHM
+#undef MOZZI__FM_OP
+
+constexpr uint8_t fmCountBits(uint8_t mask)
+{
+	return mask ? (mask & 1) + fmCountBits(mask >> 1) : 0;
+}
+
+constexpr uint8_t fmLog2Ceil(uint8_t n)
+{
+	return (n <= 1) ? 0 : 1 + fmLog2Ceil((n + 1) >> 1);
+}
+}
+
+/**
+FMVoice is a complete multi operator FM (strictly speaking: phase modulation) voice, in the style of the Yamaha DX synthesizers: 4 or 6
+operators (Oscils, normally playing a sine or cosine table), connected according to one of the classic algorithms, with feedback on one
+operator. It uses Oscil::phMod() for each modulated operator.
+
+The algorithm is chosen at compile time, and all routing is resolved by the compiler: only the connections present in the algorithm
+generate code, and operators without modulators use plain Oscil::next(). Operators are numbered 1 to OPS in the algorithm charts of the
+manuals. Here, they are addressed by index 0 to OPS-1, i.e. operator 1 is index 0.
+
+Each operator has
+- a frequency ratio to the voice frequency (setRatio()), e.g. 1.0 for the fundamental, 2.0 for an octave up, 3.5 for a bell-like
+  inharmonic partial,
+- a level (setLevel()), 0 to 255. For carriers, this is their volume, for modulators, their modulation index (255 is an index of about
+  4 pi, as the maximum on a DX7). Feed the output of an envelope (e.g. ADSR) into this for the classic evolving FM timbres.
+
+@tparam OPS number of operators, 4 or 6.
+@tparam ALGORITHM algorithm number, 1 to 8 for 4 operators (as on the DX21/DX100/TX81Z), 1 to 32 for 6 operators (as on the DX7).
+@tparam NUM_TABLE_CELLS size of the wavetable, normally a sine or cosine table, e.g. COS2048_NUM_CELLS.
+@tparam UPDATE_RATE MOZZI_AUDIO_RATE, typically.
+
+@code
+FMVoice<4, 1, COS2048_NUM_CELLS, MOZZI_AUDIO_RATE> aVoice(COS2048_DATA);  // 4 -> 3 -> 2 -> 1, i.e. one carrier, three modulators
+@endcode
+*/
+template <uint8_t OPS, uint8_t ALGORITHM, uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
+class FMVoice
+{
+	typedef MozziPrivate::FMAlgorithm<OPS, ALGORITHM> Algorithm;
+	static_assert(Algorithm::VALID, "FMVoice supports 4 operators with algorithms 1 to 8, and 6 operators with algorithms 1 to 32");
+
+public:
+	/** Constructor.
+	@param TABLE_NAME the wavetable played by all operators, normally a sine or cosine.
+	*/
+	FMVoice(const int8_t * TABLE_NAME = nullptr) : base_increment(0), feedback(0), feedback_last(0), feedback_previous(0)
+	{
+		for (uint8_t i = 0; i < OPS; ++i) {
+			operators[i].setTable(TABLE_NAME);
+			ratios[i] = 256;
+			levels[i] = 0;
+			outputs[i] = 0;
+		}
+		resetPhases();
+	}
+
+
+	/** Change the wavetable played by all operators.
+	@param TABLE_NAME is the name of the array in the table ".h" file you're using.
+	*/
+	void setTable(const int8_t * TABLE_NAME)
+	{
+		for (uint8_t i = 0; i < OPS; ++i) operators[i].setTable(TABLE_NAME);
+	}
+
+
+	/** Set the frequency of the voice. Each operator plays this, multiplied by its ratio.
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(float frequency)
+	{
+		setPhaseInc((uint32_t)((((float)NUM_TABLE_CELLS * frequency)/UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER));
+	}
+
+
+	/** Set the frequency of the voice from a (fractional) MIDI note number. See Oscil::setMidiNote().
+	@param note MIDI note number in Q8n8 fixed-point format, from 0 to 127.996 (higher values are treated as note 128)
+	*/
+	inline
+	void setMidiNote(Q8n8 note)
+	{
+		setPhaseInc(MozziPrivate::OscilMidiIncrements<NUM_TABLE_CELLS, UPDATE_RATE>::increment(note));
+	}
+
+
+	/** Set the phase increment of the voice frequency directly, see Oscil::phaseIncFromFreq().
+	@param phaseinc_fractional the phase increment
+	*/
+	inline
+	void setPhaseInc(uint32_t phaseinc_fractional)
+	{
+		base_increment = phaseinc_fractional;
+		for (uint8_t i = 0; i < OPS; ++i) updateIncrement(i);
+	}
+
+
+	/** Set the frequency ratio of one operator.
+	@param op operator index, 0 to OPS-1 (operator 1 is index 0)
+	@param ratio in Q8n8 fixed-point format, e.g. 256 for 1.0, 512 for 2.0, 128 for 0.5. The default is 1.0.
+	*/
+	inline
+	void setRatio(uint8_t op, Q8n8 ratio)
+	{
+		ratios[op] = ratio;
+		updateIncrement(op);
+	}
+
+
+	/** Set the level of one operator, e.g. from an envelope.
+	@param op operator index, 0 to OPS-1 (operator 1 is index 0)
+	@param level 0 (silent) to 255. For carriers, the volume, for modulators, the modulation index.
+	*/
+	inline
+	void setLevel(uint8_t op, uint8_t level)
+	{
+		levels[op] = level;
+	}
+
+
+	/** Set the amount of feedback on the feedback operator of the algorithm.
+	@param amount 0 (none) to 255 (modulation index of about pi, quite noisy).
+	*/
+	inline
+	void setFeedback(uint8_t amount)
+	{
+		feedback = amount;
+	}
+
+
+	/** Set all operators back to the start of their waveform, e.g. at the start of a note, for consistent attacks.
+	*/
+	void resetPhases()
+	{
+		for (uint8_t i = 0; i < OPS; ++i) operators[i].setPhase(0);
+		feedback_last = feedback_previous = 0;
+	}
+
+
+	/** Direct access to an operator, e.g. to set a fixed frequency, independent of the voice frequency.
+	@param op operator index, 0 to OPS-1 (operator 1 is index 0)
+	@return the Oscil of the operator
+	*/
+	inline
+	Oscil<NUM_TABLE_CELLS, UPDATE_RATE> & getOperator(uint8_t op)
+	{
+		return operators[op];
+	}
+
+
+	/** Advances all operators by one sample, and returns the sum of the carriers.
+	@return the next sample, in 16 bit resolution. The sum of the carriers is scaled down to fit, for algorithms with several carriers.
+	*/
+	inline
+	int16_t next()
+	{
+		MOZZI_PROFILE_SCOPE("FMVoice::next");
+		int32_t sum = 0;
+		renderOperators(sum, OpIndex<OPS - 1>());
+		return sum >> CARRIER_SHIFT;
+	}
+
+
+	/** Render a block of samples, with the same result as calling next() n times. See @ref MOZZI_AUDIO_BLOCK_SIZE.
+	@param dst where to write the samples
+	@param n number of samples to write
+	*/
+	void fill(int16_t * dst, uint16_t n)
+	{
+		while (n--) *dst++ = next();
+	}
+
+
+private:
+	static const uint8_t CARRIER_SHIFT = MozziPrivate::fmLog2Ceil(MozziPrivate::fmCountBits(Algorithm::CARRIERS));
+
+	template <uint8_t I> struct OpIndex {};
+
+	static constexpr bool modulates(uint8_t modulator, uint8_t op)
+	{
+		return (Algorithm::MODULATORS >> (8 * op + modulator)) & 1;
+	}
+
+	static constexpr bool hasInput(uint8_t op)
+	{
+		return ((Algorithm::MODULATORS >> (8 * op)) & 0xFF) || (op == Algorithm::FEEDBACK_DST);
+	}
+
+	/* Operators are rendered from the highest to the lowest, so the outputs of all modulators of an operator are ready, when it is rendered.
+	 * The recursion over operator indices is resolved at compile time. */
+	inline
+	void renderOperators(int32_t & sum, OpIndex<0>)
+	{
+		renderOperator<0>(sum);
+	}
+
+	template <uint8_t I>
+	inline
+	void renderOperators(int32_t & sum, OpIndex<I>)
+	{
+		renderOperator<I>(sum);
+		renderOperators(sum, OpIndex<I - 1>());
+	}
+
+	/* Sum of the outputs of all modulators of operator I, among the operators 0 to J */
+	template <uint8_t I>
+	inline
+	int32_t modulation(OpIndex<0>)
+	{
+		return modulates(0, I) ? outputs[0] : 0;
+	}
+
+	template <uint8_t I, uint8_t J>
+	inline
+	int32_t modulation(OpIndex<J>)
+	{
+		return (modulates(J, I) ? outputs[J] : 0) + modulation<I>(OpIndex<J - 1>());
+	}
+
+	template <uint8_t I>
+	inline
+	void renderOperator(int32_t & sum)
+	{
+		int8_t sample;
+		if (hasInput(I)) {
+			// in Q15n16, i.e. a full scale modulator shifts the phase by two cycles (an index of 4 pi)
+			Q15n16 phase_modulation = modulation<I>(OpIndex<OPS - 1>()) << 2;
+			if (I == Algorithm::FEEDBACK_DST) {
+				// average of the last two outputs, as on the DX7, to tame the tendency to oscillate at the Nyquist frequency
+				phase_modulation += (((int32_t) feedback_last + feedback_previous) * feedback) >> 9;
+			}
+			sample = operators[I].phMod(phase_modulation);
+		} else {
+			sample = operators[I].next();
+		}
+		const int16_t out = (int16_t) sample * levels[I];
+		outputs[I] = out;
+		if (I == Algorithm::FEEDBACK_SRC) {
+			feedback_previous = feedback_last;
+			feedback_last = out;
+		}
+		if ((Algorithm::CARRIERS >> I) & 1) sum += out;
+	}
+
+	inline
+	void updateIncrement(uint8_t op)
+	{
+		operators[op].setPhaseInc((base_increment >> 8) * ratios[op]);
+	}
+
+	Oscil<NUM_TABLE_CELLS, UPDATE_RATE> operators[OPS];
+	uint32_t base_increment;
+	Q8n8 ratios[OPS];
+	uint8_t levels[OPS];
+	int16_t outputs[OPS];
+	uint8_t feedback;
+	int16_t feedback_last;
+	int16_t feedback_previous;
+};
+
+/**
+@example 06.Synthesis/FM_Voice/FM_Voice.ino
+This is an example of a 4 operator FM voice with envelopes.
+*/
+
+#endif /* FMVOICE_H_ */
@@ -0,0 +1,91 @@
+/*
+ * Mailbox.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef MAILBOX_H_
+#define MAILBOX_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+
+/** @ingroup util
+Passes the latest value of something (typically a struct holding a set of control parameters) from one core (or thread) to another, without
+ever blocking either side. This is intended for platforms, where audio is rendered on a separate core (see e.g. @ref rp2040_audio_core ):
+Post new parameters from loop(), and fetch them in updateControl().
+
+Only the latest posted value is kept. If several values are posted, before the receiving side gets around to fetch(), only the last one will be received.
+If you need to receive each single value (e.g. note on and off events), use an SPSCFifo, instead.
+
+There must be only one sending, and one receiving core (or thread).
+
+@tparam T the type of data to pass. Must be trivially copyable (i.e. a plain struct, or a number).
+
+@code
+struct Params { Q16n16 freq; uint8_t gain; };
+Mailbox<Params> mailbox;
+
+void loop() {  // core 0
+  Params p = { ... };
+  mailbox.post(p);
+}
+
+void updateControl() {  // core 1
+  static Params p;
+  if (mailbox.fetch(p)) {
+    // apply new parameters
+  }
+}
+@endcode
+
+Internally, this is a sequence lock: The sender marks the data as being written, while it is updating it, and the receiver discards
+what it has read, if the data was written to at the same time.
+*/
+template <class T>
+class Mailbox
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Type passed via Mailbox must be trivially copyable");
+
+public:
+	Mailbox(): sequence(0), last_fetched(0)
+	{
+	}
+
+	/** Post a new value. Call this from the sending core, only. Overwrites any previous value that has not been fetched, yet. Never blocks. */
+	void post(const T& value) {
+		uint32_t seq = sequence.load(std::memory_order_relaxed);
+		sequence.store(seq + 1, std::memory_order_relaxed);  // odd sequence number: update in progress
+		std::atomic_thread_fence(std::memory_order_release);
+		data = value;
+		sequence.store(seq + 2, std::memory_order_release);
+	}
+
+	/** Fetch the latest value. Call this from the receiving core, only. Never blocks.
+	@param value receives the latest value. Left unchanged, if the return value is false.
+	@return true, if a new value was received. false, if there was no new post since the last fetch() (or the sender is in the middle of posting,
+	        in which case the new value will be received on the next call). */
+	bool fetch(T& value) {
+		uint32_t seq = sequence.load(std::memory_order_acquire);
+		if ((seq == last_fetched) || (seq & 1)) return false;
+		T copy = data;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (sequence.load(std::memory_order_relaxed) != seq) return false;  // data changed while we were reading it
+		value = copy;
+		last_fetched = seq;
+		return true;
+	}
+
+private:
+	std::atomic<uint32_t> sequence;
+	uint32_t last_fetched;  // only accessed by the receiver
+	T data;
+};
+
+#endif        //  #ifndef MAILBOX_H_
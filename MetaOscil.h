@@ -21,16 +21,29 @@
 #include "Oscil.h"
 #include "mozzi_fixmath.h"
 
+namespace MozziPrivate {
+// Position of the highest set bit of x (x > 0), at compile time
+constexpr uint8_t metaOscilMsb(uint32_t x) { return (x > 1) ? 1 + metaOscilMsb(x >> 1) : 0; }
+}
 
 /**
    MetaOscil is a wrapper for several Oscil. Once constructed it will behave exactly as an Oscil except that it will automatically switch between Oscil depending on the asked frequency. This allows to produce non-aliased sounds by switching between tables with less and less harmonics as the frequency increases.
+
+   The Oscil to play is selected from the phase increment, with the help of a small lookup table on its highest bits, so the cost of changing the frequency
+   does not grow with the number of Oscil. This includes setPhaseInc(), so MetaOscil can be used for audio rate pitch modulation, too.
+
+   @tparam CROSSFADE if larger than 0, the number of samples to crossfade from the previous to the new Oscil, when the selection changes. This avoids
+   clicks during glides, but costs a second table read, and a multiplication per sample while fading. Must be a power of two, at most 256. Default is 0 (switch abruptly).
 */
 
 
-template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
+template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL, uint16_t CROSSFADE = 0>
   class MetaOscil
   
 {
+  static_assert((CROSSFADE & (CROSSFADE - 1)) == 0, "CROSSFADE must be 0, or a power of two");
+  static_assert(CROSSFADE <= 256, "CROSSFADE must be at most 256");
+
  public:
   /** Constructor
       Declare a MetaOscil containing any number of Oscil pointers. Every Oscil should have the same TABLE_NUM_CELLS and UPDATE_RATE which are also passed in the MetaOscil constructor. 
@@ -76,7 +89,7 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
       current_rank = 0;
     }
 
-  void setCutoffFreqs() {};
+  void setCutoffFreqs() {updateLookup();};
 
   /** Set or change the cutoff frequency of one Oscil.
       @param rank is the rank of the Oscil.
@@ -84,13 +97,23 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
   void setCutoffFreq(int freq, byte rank)
   {
     cutoff_freqs[rank] = freq;
+    updateLookup();
   }
   
   /** Updates the phase according to the current frequency and returns the sample at the new phase position.
       @return the next sample.
   */
   inline
-    int8_t next() {return current_osc->next();}
+    int8_t next()
+  {
+    if (CROSSFADE && fade_remaining) {
+      --fade_remaining;
+      int8_t previous = previous_osc->next();
+      int8_t current = current_osc->next();
+      return current + (((int32_t) (previous - current) * fade_remaining) >> CROSSFADE_BITS);
+    }
+    return current_osc->next();
+  }
 
   /** Change the sound table which will be played by the Oscil of rank.
       @param TABLE_NAME is the name of the array in the table ".h" file you're using.
@@ -122,45 +145,22 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
       each direction.
       @return a sample from the table.*/
   inline
-    int8_t phMod(Q15n16 phmod_proportion) {return current_osc->phMod(phmod_proportion);}
+    int8_t phMod(Q15n16 phmod_proportion)
+  {
+    fade_remaining = 0;  // phase modulation is not crossfaded
+    return current_osc->phMod(phmod_proportion);
+  }
 
 
   /** Set the MetaOsc frequency with an unsigned int.
-      @param frequency to play the wave table.*/
+      @param frequency to play the wave table.
+      @param apply if false, only select the Oscil for this frequency, but do not change its frequency.*/
   inline
     void setFreq(int frequency, bool apply = true)
   {
-    if (frequency < cutoff_freqs[0])  //getting out the extreme cases
-      {
-	oscillators[0]->setPhaseFractional(current_osc->getPhaseFractional());
-	current_osc = oscillators[0];
-	current_osc->setFreq(frequency);
-      }
-    
-    else if (frequency > cutoff_freqs[N_OSCIL-1])
-      {	    
-	oscillators[N_OSCIL-1]->setPhaseFractional(current_osc->getPhaseFractional());
-	current_osc = oscillators[N_OSCIL-1];
-	current_osc->setFreq(frequency);      
-      }
-    else  // dichotomic search
-      {
-	byte low_point = 0, high_point = N_OSCIL-1, mid_point = (N_OSCIL-1)>>1;
-	while(low_point != high_point)
-	  {
-	    if (frequency > cutoff_freqs[mid_point]) low_point = mid_point+1;
-	    else if (frequency < cutoff_freqs[mid_point]) high_point = mid_point;
-	    else
-	      {
-		break;
-	      }
-	    mid_point = (low_point + high_point)>>1;
-	  }
-	oscillators[mid_point]->setPhaseFractional(current_osc->getPhaseFractional());
-	current_osc = oscillators[mid_point];
-	if (apply) current_osc->setFreq(frequency);      
-      }
-      
+    uint32_t increment = current_osc->phaseIncFromFreq(frequency);
+    if (apply) setPhaseInc(increment);
+    else select(increment);
   }
 
 
@@ -169,8 +169,8 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
   inline
     void setFreq(float frequency)
   {
-    setFreq((int) frequency, false);
-    current_osc->setFreq(frequency);    
+    current_osc->setFreq(frequency);
+    setPhaseInc(current_osc->getPhaseInc());
   }
 
 
@@ -179,8 +179,8 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
   inline
     void setFreq_Q24n8(Q24n8 frequency)
   {
-    setFreq((int) (frequency>>8), false);
     current_osc->setFreq_Q24n8(frequency);
+    setPhaseInc(current_osc->getPhaseInc());
   }
 
   
@@ -189,8 +189,8 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
   inline
     void setFreq_Q16n16(Q16n16 frequency)
   {
-    setFreq((int) (frequency>>16), false);
     current_osc->setFreq_Q16n16(frequency);
+    setPhaseInc(current_osc->getPhaseInc());
   }
 
 
@@ -209,19 +209,82 @@ template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
   inline
     unsigned long phaseIncFromFreq(int frequency) {return current_osc->phaseIncFromFreq(frequency);}
 
-  /** Set a specific phase increment.
+  /** Set a specific phase increment. This selects the Oscil to play, just like setFreq().
       @param phaseinc_fractional a phase increment value as calculated by phaseIncFromFreq().
   */
   inline
-    void setPhaseInc(unsigned long phaseinc_fractional) {current_osc->setPhaseInc(phaseinc_fractional);}
+    void setPhaseInc(unsigned long phaseinc_fractional)
+  {
+    select(phaseinc_fractional);
+    current_osc->setPhaseInc(phaseinc_fractional);
+    if (CROSSFADE && fade_remaining) previous_osc->setPhaseInc(phaseinc_fractional);
+  }
 
     
 
  private:
+  /* The lookup table covers LOOKUP_OCTAVES octaves below the phase increment for playing the whole table once per sample, with LOOKUP_STEPS
+   * entries per octave. Each entry holds the lowest rank whose cutoff is at or above the start of the entry's range. For an increment inside that
+   * range, the right rank is found by stepping up from there, which takes no more steps than there are cutoffs within one range (typically 0 or 1).
+   * Increments below the covered range are rare (a few Hz, at most), and simply start searching at rank 0. */
+  static const uint8_t LOOKUP_OCTAVES = 16;
+  static const uint8_t LOOKUP_STEPS_BITS = 2;
+  static const uint8_t LOOKUP_SIZE = LOOKUP_OCTAVES << LOOKUP_STEPS_BITS;
+  static const uint8_t TOP_BIT = OSCIL_F_BITS + MozziPrivate::metaOscilMsb(NUM_TABLE_CELLS);  // highest bit of the increment for one table per sample
+  static const uint8_t LOWEST_BIT = TOP_BIT - LOOKUP_OCTAVES + 1;
+
+  /* Index into the lookup table for the given phase increment, or -1 if below its range */
+  static inline int8_t lookupIndex(uint32_t increment)
+  {
+    if (increment < (1UL << LOWEST_BIT)) return -1;
+    uint8_t bit = (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(increment);  // not __builtin_clz(): int may be only 16 bits wide
+    if (bit > TOP_BIT) return LOOKUP_SIZE - 1;
+    uint8_t step = (increment >> (bit - LOOKUP_STEPS_BITS)) & ((1 << LOOKUP_STEPS_BITS) - 1);
+    return ((bit - LOWEST_BIT) << LOOKUP_STEPS_BITS) + step;
+  }
+
+  void updateLookup()
+  {
+    for (byte i = 0; i < N_OSCIL; ++i) {
+      cutoff_increments[i] = (uint32_t) cutoff_freqs[i] * ((OSCIL_F_BITS_AS_MULTIPLIER*NUM_TABLE_CELLS)/UPDATE_RATE);
+    }
+    byte rank = 0;
+    for (uint8_t i = 0; i < LOOKUP_SIZE; ++i) {
+      uint8_t bit = LOWEST_BIT + (i >> LOOKUP_STEPS_BITS);
+      uint32_t range_start = (1UL << bit) + ((uint32_t) (i & ((1 << LOOKUP_STEPS_BITS) - 1)) << (bit - LOOKUP_STEPS_BITS));
+      while ((rank < N_OSCIL-1) && (cutoff_increments[rank] < range_start)) ++rank;
+      lookup[i] = rank;
+    }
+  }
+
+  /* Switch to the Oscil for the given phase increment, i.e. the first one with a cutoff at or above the corresponding frequency (or the last one). */
+  inline void select(uint32_t increment)
+  {
+    int8_t index = lookupIndex(increment);
+    byte rank = (index < 0) ? 0 : lookup[index];
+    while ((rank < N_OSCIL-1) && (cutoff_increments[rank] < increment)) ++rank;
+    Oscil<NUM_TABLE_CELLS, UPDATE_RATE> * osc = oscillators[rank];
+    if (osc != current_osc) {
+      osc->setPhaseFractional(current_osc->getPhaseFractional());
+      if (CROSSFADE) {
+        /* Continue from the current mix, if still fading: the Oscil fading in (now fading out) keeps its weight, and the new one takes over
+         * that of the one fading out (be it the same Oscil, when switching back). */
+        previous_osc = current_osc;
+        fade_remaining = CROSSFADE - fade_remaining;
+      }
+      current_osc = osc;
+    }
+  }
+
   Oscil<NUM_TABLE_CELLS, UPDATE_RATE> * oscillators[N_OSCIL];
   Oscil<NUM_TABLE_CELLS, UPDATE_RATE> * current_osc = NULL;
+  Oscil<NUM_TABLE_CELLS, UPDATE_RATE> * previous_osc = NULL;
   int cutoff_freqs[N_OSCIL];
+  uint32_t cutoff_increments[N_OSCIL] = {};
+  byte lookup[LOOKUP_SIZE] = {};
   byte current_rank = 0;
+  uint16_t fade_remaining = 0;
+  static const uint8_t CROSSFADE_BITS = MozziPrivate::metaOscilMsb(CROSSFADE);
   
 };
 
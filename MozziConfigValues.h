@@ -32,6 +32,7 @@
 #define MOZZI_OUTPUT_PDM_VIA_SERIAL 106
 #define MOZZI_OUTPUT_I2S_DAC 107
 #define MOZZI_OUTPUT_INTERNAL_DAC 108
+#define MOZZI_OUTPUT_FILE 109
 
 #define MOZZI_AUDIO_INPUT_NONE 201
 #define MOZZI_AUDIO_INPUT_STANDARD 202
@@ -42,6 +43,12 @@
 #define MOZZI_I2S_FORMAT_PLAIN 401
 #define MOZZI_I2S_FORMAT_LSBJ 402
 
+#define MOZZI_LOAD_METER_NONE 501
+#define MOZZI_LOAD_METER_ENABLED 502
+
+#define MOZZI_PROFILER_NONE 601
+#define MOZZI_PROFILER_ENABLED 602
+
 // defined with some space in between, just in case. This should be numerically ordered.
 #define MOZZI_COMPATIBILITY_1_1 1100
 #define MOZZI_COMPATIBILITY_2_0 2000
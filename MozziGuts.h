@@ -114,6 +114,22 @@ their StereoOutput equivalents.
 AudioOutput updateAudio();
 #endif
 
+#if (MOZZI_AUDIO_BLOCK_SIZE > 1) || defined(FOR_DOXYGEN_ONLY)
+/** @ingroup core
+Block rendering alternative to updateAudio(), used instead of it, when @ref MOZZI_AUDIO_BLOCK_SIZE is configured to a value larger than 1.
+Fill out[0] to out[n-1] with the next n samples. n will be between 1 and MOZZI_AUDIO_BLOCK_SIZE, and never spans a call to updateControl().
+
+@code
+void updateAudioBlock(AudioOutput* out, uint16_t n) {
+  for (uint16_t i = 0; i < n; ++i) {
+    out[i] = MonoOutput::from8Bit(aSin.next());
+  }
+}
+@endcode
+*/
+void updateAudioBlock(AudioOutput* out, uint16_t n);
+#endif
+
 /** @ingroup core
 This is where you put your control code. You need updateControl() somewhere in
 your sketch, even if it's empty. updateControl() is called at the control rate
@@ -123,6 +139,76 @@ which could be done in setup().
 void updateControl();
 
 
+#if (MOZZI_CONTROL_TASKS > 0) || defined(FOR_DOXYGEN_ONLY)
+/** @ingroup core
+Register an additional function to be called at a rate of its own, in the same way as updateControl(). Only available, if @ref MOZZI_CONTROL_TASKS
+is set to the maximum number of tasks needed.
+
+The rate is given as a divisor of MOZZI_AUDIO_RATE, which must be a power of two. E.g. at an audio rate of 32768 Hz, a divisor of 32 calls the task
+at 1024 Hz, and a divisor of 1024 calls it at 32 Hz. Tasks are spread out over different samples (as far as possible), so that they do not all
+run in the same sample as each other, or as updateControl().
+
+@code
+void updateEnvelopes() { ... }  // 1 kHz
+void updateLFOs() { ... }       // 256 Hz
+
+void setup() {
+  addControlTask(updateEnvelopes, MOZZI_AUDIO_RATE / 1024);
+  addControlTask(updateLFOs, MOZZI_AUDIO_RATE / 256);
+  startMozzi();
+}
+@endcode
+
+In block mode (@ref MOZZI_AUDIO_BLOCK_SIZE), blocks are split at each task, just like at calls to updateControl(). Frequent tasks thus also limit the size
+of blocks.
+
+Call this from setup(), only.
+@param callback the function to call
+@param audio_rate_divisor number of audio samples between two calls. Must be a power of two.
+@return false, if the task could not be added (too many tasks, or divisor is not a power of two)
+*/
+bool addControlTask(void (*callback)(), uint16_t audio_rate_divisor);
+#endif
+
+
+#if (MOZZI_EVENT_QUEUE_SIZE > 0) || defined(FOR_DOXYGEN_ONLY)
+/** @ingroup core
+An event to be handled at an exact sample, see scheduleEvent(). What the fields mean is entirely up to the sketch. E.g. for a note on,
+type could be a constant NOTE_ON, param the MIDI note, and value the velocity. For setting a parameter, param could identify the parameter,
+and value hold the new value.
+*/
+struct MozziEvent {
+  uint32_t tick;    ///< audio tick at which the event is handled
+  uint8_t type;
+  uint8_t param;
+  int16_t value;
+};
+
+/** @ingroup core
+Queue an event to be handled at the exact sample given by tick, rather than at the next call to updateControl(). Only available, if
+@ref MOZZI_EVENT_QUEUE_SIZE is set to the maximum number of pending events.
+
+When rendering reaches the sample at tick, handleAudioEvent() is called with the event, right before that sample is rendered by updateAudio()
+(or, in block mode, at the start of a block, which is split at the event). Events for the same tick are handled in the order they were scheduled.
+
+tick is in the same unit as audioTicks(), and the sample rendered for tick k will be output, when audioTicks() reaches k. Since rendering runs
+ahead of the output by up to the size of the output buffer, events scheduled for audioTicks() + MOZZI_OUTPUT_BUFFER_SIZE (or later) will be handled
+exactly in time, with a constant latency. Events scheduled for a tick that has already been rendered are handled immediately, before the next sample.
+
+Call this from the code that renders audio, i.e. updateControl(), control tasks, handleAudioEvent(), or loop() (but on multi core setups, such as
+@ref rp2040_audio_core , only from the core that renders audio).
+@return false, if the queue is full. The event is dropped in that case.
+*/
+bool scheduleEvent(uint32_t tick, uint8_t type, uint8_t param = 0, int16_t value = 0);
+
+/** @ingroup core
+When using @ref MOZZI_EVENT_QUEUE_SIZE , you need to define this function in your sketch. It is called for each event queued with scheduleEvent(),
+right before rendering the sample at the event's tick.
+*/
+void handleAudioEvent(const MozziEvent &event);
+#endif
+
+
 /** @ingroup core
 This is required in Arduino's loop(). If there is room in Mozzi's output buffer,
 audioHook() calls updateAudio() once and puts the result into the output
@@ -179,7 +265,7 @@ MOZZI_DEPRECATED("2.0", "This use of getAudioInput() is not portable. Refer to t
 /** @ingroup core
 An alternative for Arduino time functions like micros() and millis(). This is slightly faster than micros(),
 and also it is synchronized with the currently processed audio sample (which, due to the audio
-output buffer, could diverge up to 256/MOZZI_AUDIO_RATE seconds from the current time).
+output buffer, could diverge up to MOZZI_OUTPUT_BUFFER_SIZE/MOZZI_AUDIO_RATE seconds from the current time, see @ref MOZZI_OUTPUT_BUFFER_SIZE).
 audioTicks() is updated each time an audio sample
 is output, so the resolution is 1/MOZZI_AUDIO_RATE microseconds (61 microseconds when MOZZI_AUDIO_RATE is
 16384 Hz).
@@ -192,7 +278,7 @@ unsigned long audioTicks();
 /** @ingroup core
 An alternative for Arduino time functions like micros() and millis(). This is slightly faster than micros(),
 and also it is synchronized with the currently processed audio sample (which, due to the audio
-output buffer, could diverge up to 256/MOZZI_AUDIO_RATE seconds from the current time).
+output buffer, could diverge up to MOZZI_OUTPUT_BUFFER_SIZE/MOZZI_AUDIO_RATE seconds from the current time, see @ref MOZZI_OUTPUT_BUFFER_SIZE).
 audioTicks() is updated each time an audio sample
 is output, so the resolution is 1/MOZZI_AUDIO_RATE microseconds (61 microseconds when MOZZI_AUDIO_RATE is
 16384 Hz).
@@ -201,6 +287,52 @@ is output, so the resolution is 1/MOZZI_AUDIO_RATE microseconds (61 microseconds
 */
 unsigned long mozziMicros();
 
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED) || defined(FOR_DOXYGEN_ONLY)
+/** @ingroup core
+Fraction of the available CPU time spent rendering audio, i.e. in updateAudio() (or updateAudioBlock()) plus updateControl(),
+averaged over the last 1024 samples (or so). 1.0 means that rendering takes exactly as long as playing back, and any more will result
+in buffer underruns. Only available with @ref MOZZI_LOAD_METER enabled.
+
+Note that on platforms that use the output buffer, temporary peaks above 1.0 are fine, as long as the buffer does not run empty.
+See mozziBufferLowWater(), and mozziUnderruns().
+*/
+float mozziCpuLoad();
+
+/** @ingroup core
+Average number of CPU cycles spent rendering one sample, including the share of updateControl(), over the last 1024 samples (or so).
+Only available with @ref MOZZI_LOAD_METER enabled.
+*/
+uint32_t mozziAverageCycles();
+
+/** @ingroup core
+Largest number of CPU cycles spent on a single sample, since the start, or the last call to mozziResetLoadMeter(). This will usually
+be a sample at which updateControl() was called. In block mode (see @ref MOZZI_AUDIO_BLOCK_SIZE), this is the average per sample of the most
+expensive block. Only available with @ref MOZZI_LOAD_METER enabled.
+*/
+uint32_t mozziPeakCycles();
+
+/** @ingroup core
+Number of times the output found the output buffer empty, i.e. audio was not rendered in time, since the start, or the last call to
+mozziResetLoadMeter(). Only available with @ref MOZZI_LOAD_METER enabled.
+
+@note Output modes that do not use Mozzi's output buffer (see @ref MOZZI_OUTPUT_BUFFER_SIZE) cannot detect underruns, and will always report 0.
+*/
+uint32_t mozziUnderruns();
+
+/** @ingroup core
+Lowest number of samples in the output buffer, seen by the output, since the start, or the last call to mozziResetLoadMeter(). The closer this
+gets to 0, the closer your sketch is to audible glitches. Only available with @ref MOZZI_LOAD_METER enabled.
+
+@note Output modes that do not use Mozzi's output buffer (see @ref MOZZI_OUTPUT_BUFFER_SIZE) will always report 0.
+*/
+uint16_t mozziBufferLowWater();
+
+/** @ingroup core
+Reset the peak, underrun, and low-water measurements. Only available with @ref MOZZI_LOAD_METER enabled.
+*/
+void mozziResetLoadMeter();
+#endif
+
 #ifndef _MOZZI_HEADER_ONLY
 #include "internal/MozziGuts.hpp"
 #endif
@@ -21,9 +21,14 @@
 #include "mozzi_fixmath.h"
 #include "FixMath.h"
 #include "mozzi_pgmspace.h"
+#include "mozzi_profile.h"
+#include "mozzi_utils.h"
+#include "IntegerType.h"
 
 #ifdef OSCIL_DITHER_PHASE
-#include "mozzi_rand.h"
+#define OSCIL__DITHER_PHASE_DEFAULT true
+#else
+#define OSCIL__DITHER_PHASE_DEFAULT false
 #endif
 
 // fractional bits for oscillator index precision
@@ -33,6 +38,103 @@
 // phmod_proportion is an 15n16 fixed-point number
 #define OSCIL_PHMOD_BITS 16
 
+namespace MozziPrivate {
+/* Source of phase dither for Oscil: a 16 bit Galois LFSR (maximum length, period 65535), one per oscillator. The phase of a
+ * dithered Oscil is kept ahead of the undithered phase by the current LFSR value, i.e. by up to one table cell. step() moves the
+ * phase to the next random offset, so the dither costs nothing per sample, only per step. tick() counts down the samples played
+ * one by one (next(), phMod()), and steps every PERIOD samples, so these get a new offset as often as blocks of the default size.
+ * The disabled version does nothing, and takes no space (used as an empty base of Oscil). */
+template <bool ENABLED> class OscilDither
+{
+public:
+	static const uint8_t PERIOD = 32;
+	OscilDither(): lfsr(0xACE1), countdown(PERIOD) {}
+	inline
+	void step(uint32_t & phase)
+	{
+		const uint16_t previous = lfsr;
+		lfsr = (lfsr >> 1) ^ ((lfsr & 1) ? 0xB400u : 0u);
+		phase += (uint32_t) lfsr - previous;
+	}
+	inline
+	void tick(uint32_t & phase)
+	{
+		if (!--countdown) {
+			countdown = PERIOD;
+			step(phase);
+		}
+	}
+private:
+	uint16_t lfsr;
+	uint8_t countdown;
+};
+
+template <> class OscilDither<false>
+{
+public:
+	inline
+	void step(uint32_t &) {}
+	inline
+	void tick(uint32_t &) {}
+};
+
+/* Frequencies of MIDI notes 0 to 11 */
+constexpr double oscilMidiBaseFrequencies[12] = {8.175798915643707, 8.661957218027252, 9.177023997418988, 9.722718241315029, 10.300861153527183,
+	10.913382232281373, 11.562325709738575, 12.249857374429663, 12.978271799373287, 13.75, 14.567617547440307, 15.433853164253883};
+
+/* Phase increment for the given phase increment as a double, rounded, and limited to 32 bits. Evaluated at compile time. */
+constexpr uint32_t oscilMidiIncrementClamped(double increment)
+{
+	return (increment >= 4294967295.0) ? 0xFFFFFFFFUL : (uint32_t) (increment + 0.5);
+}
+
+/* Phase increment for a MIDI note. Evaluated at compile time. */
+constexpr uint32_t oscilMidiIncrement(uint8_t note, uint16_t num_table_cells, uint16_t update_rate)
+{
+	return oscilMidiIncrementClamped(oscilMidiBaseFrequencies[note % 12] * (double) (1UL << (note / 12)) * num_table_cells / update_rate * OSCIL_F_BITS_AS_MULTIPLIER);
+}
+
+/* Phase increments of MIDI notes 0 to 128 (the last one for interpolation), for one combination of table size and update rate.
+ * Used by Oscil::setMidiNote(). */
+template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE> class OscilMidiIncrements
+{
+public:
+	/* Phase increment for a MIDI note in Q8n8 format, interpolated linearly between semitones. Notes of 128 and above give the
+	 * increment of note 128 (rather than reading past the end of the table). */
+	static inline
+	uint32_t increment(Q8n8 note)
+	{
+		if (note >= (128 << 8)) return FLASH_OR_RAM_READ<const uint32_t>(table + 128);
+		const uint8_t note_int = note >> 8;
+		const uint8_t fraction = note;
+		const uint32_t lower = FLASH_OR_RAM_READ<const uint32_t>(table + note_int);
+		const uint32_t upper = FLASH_OR_RAM_READ<const uint32_t>(table + note_int + 1);
+		const uint32_t difference = upper - lower;
+		// keep all bits of small differences, while making sure, large ones don't overflow
+		return lower + ((difference < 0x1000000UL) ? ((difference * fraction) >> 8) : ((difference >> 8) * fraction));
+	}
+
+	static CONSTTABLE_STORAGE(uint32_t) table[129];
+};
+
+#define OSCIL__MIDI_INC(note) oscilMidiIncrement(note, NUM_TABLE_CELLS, UPDATE_RATE)
+#define OSCIL__MIDI_INC_OCTAVE(octave) OSCIL__MIDI_INC(octave*12), OSCIL__MIDI_INC(octave*12+1), OSCIL__MIDI_INC(octave*12+2), \
+	OSCIL__MIDI_INC(octave*12+3), OSCIL__MIDI_INC(octave*12+4), OSCIL__MIDI_INC(octave*12+5), OSCIL__MIDI_INC(octave*12+6), \
+	OSCIL__MIDI_INC(octave*12+7), OSCIL__MIDI_INC(octave*12+8), OSCIL__MIDI_INC(octave*12+9), OSCIL__MIDI_INC(octave*12+10), \
+	OSCIL__MIDI_INC(octave*12+11)
+
+template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
+CONSTTABLE_STORAGE(uint32_t) OscilMidiIncrements<NUM_TABLE_CELLS, UPDATE_RATE>::table[129] = {
+	OSCIL__MIDI_INC_OCTAVE(0), OSCIL__MIDI_INC_OCTAVE(1), OSCIL__MIDI_INC_OCTAVE(2), OSCIL__MIDI_INC_OCTAVE(3), OSCIL__MIDI_INC_OCTAVE(4),
+	OSCIL__MIDI_INC_OCTAVE(5), OSCIL__MIDI_INC_OCTAVE(6), OSCIL__MIDI_INC_OCTAVE(7), OSCIL__MIDI_INC_OCTAVE(8), OSCIL__MIDI_INC_OCTAVE(9),
+	OSCIL__MIDI_INC(120), OSCIL__MIDI_INC(121), OSCIL__MIDI_INC(122), OSCIL__MIDI_INC(123), OSCIL__MIDI_INC(124), OSCIL__MIDI_INC(125),
+	OSCIL__MIDI_INC(126), OSCIL__MIDI_INC(127), OSCIL__MIDI_INC(128)
+};
+
+#undef OSCIL__MIDI_INC_OCTAVE
+#undef OSCIL__MIDI_INC
+}
+
 /**
 Oscil plays a wavetable, cycling through the table to generate an audio or
 control signal. The frequency of the signal can be set or changed with
@@ -45,21 +147,31 @@ defined macro, rather than a const or int, for the Oscil to run fast enough.
 updateAudio(), or MOZZI_CONTROL_RATE if it's updated each time updateControl() is
 called. It could also be a fraction of MOZZI_CONTROL_RATE if you are doing some kind
 of cyclic updating in updateControl(), for example, to spread out the processor load.
+@tparam T the type of samples in the table, int8_t (default) or int16_t (e.g. tables/cos4096_int16.h). next(), etc. return the same type.
+@tparam INTERP INTERP_NONE (default) to play the table cell at the current phase, or INTERP_LINEAR to interpolate between the two
+nearest cells, using the fractional part of the phase. Interpolation costs two table reads and a multiplication per sample, but
+a small interpolated table can sound as clean as a much larger one without interpolation (e.g. 512 cells interpolated, rather than 8192).
 @todo Use conditional compilation to optimise setFreq() variations for different table
 sizes.
-@note If you #define OSCIL_DITHER_PHASE before you #include <Oscil.h>,
-the phase increments will be dithered, which reduces spurious frequency spurs
-in the audio output, at the cost of some extra processing and memory.
+@tparam DITHER_PHASE if true, the phase is moved to a new small random offset (up to one table cell) at the start of each block
+rendered with fill() or addTo(), every 32 samples played with next() or phMod(), and whenever the frequency is set. This spreads the spurs caused by truncating the phase to a table
+index (harmonically unrelated tones, esp. audible with small tables) into a low level of noise, so small tables sound cleaner (most of
+all int16_t tables, as with int8_t tables, the 8 bit resolution of the samples themselves causes spurs of similar level). The shorter
+the stretches between two offsets, the better: with blocks of 32 samples (see @ref MOZZI_AUDIO_BLOCK_SIZE), spurs of a 256 cell int16_t
+table drop by about 10 dB (see extras/tests/OscilDither). The random numbers come from a tiny LFSR in each oscillator, costing 3 bytes of
+RAM, and a few instructions per block, or per frequency change, but nothing per sample with fill() or addTo() (next() and phMod() count
+down to the next offset). If you #define OSCIL_DITHER_PHASE before you #include <Oscil.h>, this
+defaults to true for all Oscils. Dithering is not useful with INTERP_LINEAR.
 @section int8_t2mozzi
 Converting soundfiles for Mozzi
 There is a python script called char2mozzi.py in the Mozzi/python folder.
 The usage is:
 char2mozzi.py infilename outfilename tablename samplerate
 */
-//template <unsigned int NUM_TABLE_CELLS, unsigned int UPDATE_RATE, bool DITHER_PHASE=false>
-template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
-class Oscil
+template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, class T = int8_t, uint8_t INTERP = INTERP_NONE, bool DITHER_PHASE = OSCIL__DITHER_PHASE_DEFAULT>
+class Oscil : private MozziPrivate::OscilDither<DITHER_PHASE>
 {
+	static_assert(sizeof(T) <= 2, "Oscil supports tables of int8_t or int16_t, only");
 
 
 public:
@@ -68,7 +180,7 @@ public:
 	can be found in the table ".h" file if you are using a table made for
 	Mozzi by the int8_t2mozzi.py python script in Mozzi's python
 	folder.*/
-	Oscil(const int8_t * TABLE_NAME):table(TABLE_NAME)
+	Oscil(const T * TABLE_NAME):table(TABLE_NAME)
 	{}
 
 
@@ -86,17 +198,75 @@ public:
 	@return the next sample.
 	*/
 	inline
-	int8_t next()
+	T next()
 	{
+		MOZZI_PROFILE_SCOPE("Oscil::next");
 		incrementPhase();
 		return readTable();
 	}
 
 
+	/** Fill a block of samples, with the same result as calling next() n times (except that a dithered Oscil moves to a new dither
+	offset, first, see DITHER_PHASE), but faster, especially for several oscillators in block mode (see @ref MOZZI_AUDIO_BLOCK_SIZE).
+	@param dst where to write the samples
+	@param n number of samples to write
+	*/
+	inline
+	void fill(T * dst, uint16_t n)
+	{
+		MOZZI_PROFILE_SCOPE("Oscil::fill");
+		stepDither();
+		// work on local copies, so the compiler can keep them in registers
+		uint32_t phase = phase_fractional;
+		const uint32_t increment = phase_increment_fractional;
+		const T * const tab = table;
+		for (; n >= 4; n -= 4) {
+			dst[0] = lookup(tab, phase += increment);
+			dst[1] = lookup(tab, phase += increment);
+			dst[2] = lookup(tab, phase += increment);
+			dst[3] = lookup(tab, phase += increment);
+			dst += 4;
+		}
+		while (n--) {
+			*dst++ = lookup(tab, phase += increment);
+		}
+		phase_fractional = phase;
+	}
+
+
+	/** Add a block of samples, scaled by gain, to what's already in dst. Useful to sum up several oscillators (e.g. for
+	additive synthesis) in block mode (see @ref MOZZI_AUDIO_BLOCK_SIZE). Advances the phase just like calling next() n times.
+	@param dst samples to add to. For each, (next() * gain) >> 8 is added. Typically int16_t for int8_t tables, and int32_t for int16_t tables.
+	@param n number of samples
+	@param gain amplitude, where 255 is (almost) full scale
+	*/
+	template <typename ACC>
+	inline
+	void addTo(ACC * dst, uint16_t n, uint8_t gain)
+	{
+		MOZZI_PROFILE_SCOPE("Oscil::addTo");
+		stepDither();
+		uint32_t phase = phase_fractional;
+		const uint32_t increment = phase_increment_fractional;
+		const T * const tab = table;
+		for (; n >= 4; n -= 4) {
+			dst[0] += scale(lookup(tab, phase += increment), gain);
+			dst[1] += scale(lookup(tab, phase += increment), gain);
+			dst[2] += scale(lookup(tab, phase += increment), gain);
+			dst[3] += scale(lookup(tab, phase += increment), gain);
+			dst += 4;
+		}
+		while (n--) {
+			*dst++ += scale(lookup(tab, phase += increment), gain);
+		}
+		phase_fractional = phase;
+	}
+
+
 	/** Change the sound table which will be played by the Oscil.
 	@param TABLE_NAME is the name of the array in the table ".h" file you're using.
 	*/
-	void setTable(const int8_t * TABLE_NAME)
+	void setTable(const T * TABLE_NAME)
 	{
 		table = TABLE_NAME;
 	}
@@ -146,10 +316,10 @@ public:
 	// FM: cos(angle += (incr + change))
 	// The ratio of deviation to modulation frequency is called the "index of modulation". ( I = d / Fm )
 	inline
-	int8_t phMod(Q15n16 phmod_proportion)
+	T phMod(Q15n16 phmod_proportion)
 	{
 		incrementPhase();
-		return FLASH_OR_RAM_READ<const int8_t>(table + (((phase_fractional+(phmod_proportion * NUM_TABLE_CELLS))>>OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
+		return lookup(table, phase_fractional+(phmod_proportion * NUM_TABLE_CELLS));
 	}
 
 
@@ -161,7 +331,7 @@ public:
 	*/
   template <int8_t NI, int8_t NF, uint8_t RANGE>
 	inline
-  int8_t phMod(SFix<NI,NF,RANGE> phmod_proportion)
+  T phMod(SFix<NI,NF,RANGE> phmod_proportion)
 	{
 	  return phMod(SFix<15,16>(phmod_proportion).asRaw());
 	}
@@ -175,7 +345,7 @@ public:
 	@return a sample from the table.
 	*/
 	inline
-	int8_t phMod(SFix<15,16> phmod_proportion)
+	T phMod(SFix<15,16> phmod_proportion)
 	{
 	  return phMod(phmod_proportion.asRaw());
 	}
@@ -195,6 +365,7 @@ public:
 		//phase_increment_fractional = ((((uint32_t)NUM_TABLE_CELLS<<ADJUST_FOR_NUM_TABLE_CELLS)*frequency)/UPDATE_RATE) << (OSCIL_F_BITS - ADJUST_FOR_NUM_TABLE_CELLS);
 		// to this:
 		phase_increment_fractional = ((uint32_t)frequency) * ((OSCIL_F_BITS_AS_MULTIPLIER*NUM_TABLE_CELLS)/UPDATE_RATE);
+		stepDither();
 	}
 
 
@@ -207,6 +378,7 @@ public:
 	void setFreq(float frequency)
 	{ // 1 us - using float doesn't seem to incur measurable overhead with the oscilloscope
 		phase_increment_fractional = (uint32_t)((((float)NUM_TABLE_CELLS * frequency)/UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER);
+		stepDither();
 	}
 
 
@@ -247,6 +419,7 @@ public:
 		} else {
 			phase_increment_fractional = ((uint32_t)frequency) / (UPDATE_RATE/(256UL*NUM_TABLE_CELLS));
 		}
+		stepDither();
 	}
 
   	/** Set the frequency using UFix<24,8> fixed-point number format.
@@ -285,6 +458,7 @@ public:
 		} else {
 			phase_increment_fractional = ((uint32_t)frequency) / (UPDATE_RATE/NUM_TABLE_CELLS);
 		}
+		stepDither();
 	}
 
 
@@ -317,22 +491,45 @@ public:
         {
 	  setFreq_Q16n16(UFix<16,16>(frequency).asRaw());
         }
-  
-/*
+
+
+	/** Set the frequency from a MIDI note number, with a fractional part for pitch bend, vibrato, glides, or microtonal tunings.
+	This is considerably faster and more accurate than setFreq_Q16n16(Q16n16_mtof(...)), as the phase increments of all MIDI
+	notes for this combination of NUM_TABLE_CELLS and UPDATE_RATE are calculated at compile time, and just need to be looked up,
+	and interpolated linearly between semitones. The table takes 516 bytes of flash for each combination of NUM_TABLE_CELLS and
+	UPDATE_RATE used with setMidiNote() (not for each Oscil).
+	@param note MIDI note number in Q8n8 fixed-point format, from 0 to 127.996, e.g. (60 << 8) + 128 for a quarter tone above
+	middle C. Higher values are treated as note 128. Frequencies above UPDATE_RATE/2 (e.g. high notes at MOZZI_CONTROL_RATE) will
+	not play correctly.
+	*/
 	inline
-	void setFreqMidi(int8_t note_num) {
-		setFreq_Q16n16(mtof(note_num));
+	void setMidiNote(Q8n8 note)
+	{
+		phase_increment_fractional = MozziPrivate::OscilMidiIncrements<NUM_TABLE_CELLS, UPDATE_RATE>::increment(note);
+		stepDither();
 	}
-*/
+
+
+	/** Set the frequency from a MIDI note number, in UFix<NI,NF> fixed-point format, see setMidiNote(Q8n8). Fractional bits beyond
+	8 are ignored.
+	@param note MIDI note number, from 0 to 127.996. Higher values are treated as note 128.
+	*/
+	template <int8_t NI, int8_t NF, uint64_t RANGE>
+	inline
+	void setMidiNote(UFix<NI,NF,RANGE> note)
+	{
+		setMidiNote((Q8n8) UFix<8,8>(note).asRaw());
+	}
+
 	/**  Returns the sample at the given table index.
 	@param index between 0 and the table size.The
 	index rolls back around to 0 if it's larger than the table size.
 	@return the sample at the given table index.
 	*/
 	inline
-	int8_t atIndex(unsigned int index)
+	T atIndex(unsigned int index)
 	{
-		return FLASH_OR_RAM_READ<const int8_t>(table + (index & (NUM_TABLE_CELLS - 1)));
+		return FLASH_OR_RAM_READ<const T>(table + (index & (NUM_TABLE_CELLS - 1)));
 	}
 
 
@@ -363,11 +560,23 @@ public:
 	void setPhaseInc(uint32_t phaseinc_fractional)
 	{
 		phase_increment_fractional = phaseinc_fractional;
+		stepDither();
+	}
+
+
+	/** Get the current phase increment, as set by setFreq() or setPhaseInc().
+	@return the phase increment, i.e. the number of table cells per update, shifted left by OSCIL_F_BITS.
+	 */
+	inline
+	uint32_t getPhaseInc()
+	{
+		return phase_increment_fractional;
 	}
 
 
 
 private:
+	typedef MozziPrivate::OscilDither<DITHER_PHASE> Dither;
 
 
 	/** Used for shift arithmetic in setFreq() and its variations.
@@ -375,33 +584,63 @@ private:
 static const uint8_t ADJUST_FOR_NUM_TABLE_CELLS = (NUM_TABLE_CELLS<2048) ? 8 : 0;
 
 
-	/** Increments the phase of the oscillator without returning a sample.
+	/** Increments the phase of the oscillator without returning a sample (and moves to a new dither offset, when due).
 	 */
 	inline
 	void incrementPhase()
 	{
 		//phase_fractional += (phase_increment_fractional | 1); // odd phase incr, attempt to reduce frequency spurs in output
 		phase_fractional += phase_increment_fractional;
+		static_cast<Dither &>(*this).tick(phase_fractional);
+	}
+
+
+	/** Returns the sample at the given phase, interpolated if INTERP is INTERP_LINEAR.
+	 */
+	static inline
+	T lookup(const T * tab, uint32_t phase)
+	{
+		uint16_t index = (phase >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1);
+		T out = FLASH_OR_RAM_READ<const T>(tab + index);
+		if (INTERP == INTERP_LINEAR) {
+			T following = FLASH_OR_RAM_READ<const T>(tab + ((index + 1) & (NUM_TABLE_CELLS - 1)));
+			// only 15 of the 16 fractional bits, so the product of the difference (up to 17 bits for int16_t) and the fraction fits into 32 bits
+			out += (T) ((((int32_t) following - out) * (int32_t) (((uint16_t) phase) >> 1) + (1 << 14)) >> 15);
+		}
+		return out;
 	}
 
 
 	/** Returns the current sample.
 	 */
 	inline
-	int8_t readTable()
+	T readTable()
 	{
-#ifdef OSCIL_DITHER_PHASE
-		return FLASH_OR_RAM_READ<const int8_t>(table + (((phase_fractional + ((int)(xorshift96()>>16))) >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
-#else
-		return FLASH_OR_RAM_READ<const int8_t>(table + ((phase_fractional >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
-		//return FLASH_OR_RAM_READ<int8_t>(table + (((phase_fractional >> OSCIL_F_BITS) | 1 ) & (NUM_TABLE_CELLS - 1))); odd phase, attempt to reduce frequency spurs in output
-#endif
+		return lookup(table, phase_fractional);
+	}
+
+
+	/** Moves the phase to a new random offset, if DITHER_PHASE is true. Does nothing, otherwise.
+	 */
+	inline
+	void stepDither()
+	{
+		static_cast<Dither &>(*this).step(phase_fractional);
+	}
+
+
+	/** Scales a sample by gain / 256, as used by addTo(). The product fits into 16 bits for int8_t tables.
+	 */
+	static inline
+	typename IntegerType<sizeof(T)*2>::signed_type scale(T sample, uint8_t gain)
+	{
+		return ((typename IntegerType<sizeof(T)*2>::signed_type) sample * gain) >> 8;
 	}
 
 
 	uint32_t phase_fractional;
 	uint32_t phase_increment_fractional;
-	const int8_t * table;
+	const T * table;
 
 };
 
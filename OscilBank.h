@@ -0,0 +1,237 @@
+/*
+ * OscilBank.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef OSCILBANK_H_
+#define OSCILBANK_H_
+
+#include "Arduino.h"
+#include "Oscil.h"
+
+/**
+OscilBank plays the same wavetable at many different frequencies, and sums the results, as needed for additive synthesis and organ
+sounds. Compared to an array of Oscil, all phases, phase increments, and amplitudes are kept in contiguous arrays, and one table is shared
+by all oscillators. The sum is calculated in one tight loop, which is considerably faster, esp. when rendering blocks with fill().
+
+Oscillators in the bank are addressed by their index, 0 to NUM_OSCILS-1. Each has its own frequency, and amplitude (0 to 255). Initially,
+all amplitudes are 0.
+
+@tparam NUM_OSCILS the number of oscillators in the bank (at most 256).
+@tparam NUM_TABLE_CELLS size of the wavetable, as for Oscil. Must be a power of two.
+@tparam UPDATE_RATE MOZZI_AUDIO_RATE or MOZZI_CONTROL_RATE, as for Oscil.
+
+@code
+OscilBank<32, SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aPartials(SIN2048_DATA);
+
+void setup() {
+  aPartials.setHarmonics(110.f);
+  for (uint8_t i = 0; i < 32; ++i) aPartials.setAmplitude(i, 255 / (i + 1));  // sawtooth like spectrum
+  startMozzi();
+}
+
+AudioOutput updateAudio() {
+  return MonoOutput::fromNBit(10, aPartials.next());
+}
+@endcode
+*/
+template <uint16_t NUM_OSCILS, uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
+class OscilBank
+{
+	static_assert((NUM_OSCILS > 0) && (NUM_OSCILS <= 256), "OscilBank must have between 1 and 256 oscillators");
+	static_assert((NUM_TABLE_CELLS & (NUM_TABLE_CELLS - 1)) == 0, "NUM_TABLE_CELLS must be a power of two");
+
+public:
+	/** Constructor.
+	@param TABLE_NAME the wavetable shared by all oscillators in the bank.
+	*/
+	OscilBank(const int8_t * TABLE_NAME = nullptr) : table(TABLE_NAME)
+	{
+		for (uint16_t i = 0; i < NUM_OSCILS; ++i) {
+			phases[i] = 0;
+			increments[i] = 0;
+			amplitudes[i] = 0;
+		}
+	}
+
+
+	/** Change the wavetable used by all oscillators in the bank.
+	@param TABLE_NAME is the name of the array in the table ".h" file you're using.
+	*/
+	void setTable(const int8_t * TABLE_NAME)
+	{
+		table = TABLE_NAME;
+	}
+
+
+	/** Set the frequency of one oscillator.
+	@param index which oscillator
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(uint8_t index, float frequency)
+	{
+		increments[index] = (uint32_t)((((float)NUM_TABLE_CELLS * frequency)/UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER);
+	}
+
+
+	/** Set the frequency of one oscillator, in Q16n16 fixed-point format. See Oscil::setFreq_Q16n16() for the limitations.
+	@param index which oscillator
+	@param frequency in Q16n16 fixed-point format
+	*/
+	inline
+	void setFreq_Q16n16(uint8_t index, Q16n16 frequency)
+	{
+		if (NUM_TABLE_CELLS >= UPDATE_RATE) {
+			increments[index] = ((uint32_t)frequency) * (NUM_TABLE_CELLS/UPDATE_RATE);
+		} else {
+			increments[index] = ((uint32_t)frequency) / (UPDATE_RATE/NUM_TABLE_CELLS);
+		}
+	}
+
+
+	/** Set all oscillators to the harmonics of a base frequency, i.e. oscillator i plays (i+1) * base_frequency. Harmonics above
+	half of UPDATE_RATE would alias, and are silenced by setting their frequency to 0 (their amplitude is left unchanged).
+	@param base_frequency the frequency of oscillator 0, in Hz
+	*/
+	void setHarmonics(float base_frequency)
+	{
+		uint32_t increment = (uint32_t)((((float)NUM_TABLE_CELLS * base_frequency)/UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER);
+		const uint32_t limit = (uint32_t) NUM_TABLE_CELLS << (OSCIL_F_BITS - 1);  // half a table per sample: Nyquist frequency
+		uint32_t harmonic_increment = increment;
+		uint16_t i = 0;
+		// Both terms stay below limit (at most 2^30), so the sum cannot wrap around, before the loop stops
+		for (; (i < NUM_OSCILS) && (harmonic_increment < limit); ++i) {
+			increments[i] = harmonic_increment;
+			harmonic_increment += increment;
+		}
+		for (; i < NUM_OSCILS; ++i) increments[i] = 0;
+	}
+
+
+	/** Set a specific phase increment for one oscillator. See Oscil::phaseIncFromFreq().
+	@param index which oscillator
+	@param phaseinc_fractional the phase increment
+	*/
+	inline
+	void setPhaseInc(uint8_t index, uint32_t phaseinc_fractional)
+	{
+		increments[index] = phaseinc_fractional;
+	}
+
+
+	/** Set the phase of one oscillator.
+	@param index which oscillator
+	@param phase a position in the wavetable.
+	*/
+	inline
+	void setPhase(uint8_t index, unsigned int phase)
+	{
+		phases[index] = (uint32_t)phase << OSCIL_F_BITS;
+	}
+
+
+	/** Set the amplitude of one oscillator.
+	@param index which oscillator
+	@param amplitude 0 (silent) to 255 (full scale)
+	*/
+	inline
+	void setAmplitude(uint8_t index, uint8_t amplitude)
+	{
+		amplitudes[index] = amplitude;
+	}
+
+
+	/** Set the amplitudes of all oscillators at once.
+	@param new_amplitudes array of NUM_OSCILS amplitudes, 0 to 255 each
+	*/
+	void setAmplitudes(const uint8_t * new_amplitudes)
+	{
+		for (uint16_t i = 0; i < NUM_OSCILS; ++i) amplitudes[i] = new_amplitudes[i];
+	}
+
+
+	/** Direct access to the array of amplitudes, e.g. for updating them in a loop of your own.
+	@return pointer to NUM_OSCILS amplitudes
+	*/
+	inline
+	uint8_t * getAmplitudes()
+	{
+		return amplitudes;
+	}
+
+
+	/** Advances all oscillators by one sample, and returns the sum of their outputs, each scaled by its amplitude.
+	@return the sum of (sample * amplitude) >> 8 over all oscillators, i.e. up to +-127 * NUM_OSCILS.
+	*/
+	inline
+	int16_t next()
+	{
+		MOZZI_PROFILE_SCOPE("OscilBank::next");
+		const int8_t * const tab = table;
+		int32_t sum = 0;
+		for (uint16_t i = 0; i < NUM_OSCILS; ++i) {
+			uint32_t phase = phases[i] + increments[i];
+			phases[i] = phase;
+			sum += (int16_t) FLASH_OR_RAM_READ<const int8_t>(tab + ((phase >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1))) * amplitudes[i];
+		}
+		return sum >> 8;
+	}
+
+
+	/** Render a block of samples, with the same result as calling next() n times, but much faster. Use this in updateAudioBlock()
+	(see @ref MOZZI_AUDIO_BLOCK_SIZE).
+	@param dst where to write the samples
+	@param n number of samples to write
+	*/
+	void fill(int16_t * dst, uint16_t n)
+	{
+		MOZZI_PROFILE_SCOPE("OscilBank::fill");
+		const int8_t * const tab = table;
+		int32_t sums[FILL_CHUNK];
+		while (n) {
+			const uint16_t chunk = (n < FILL_CHUNK) ? n : FILL_CHUNK;
+			for (uint16_t j = 0; j < chunk; ++j) sums[j] = 0;
+			// one oscillator at a time, so its phase, increment and amplitude stay in registers
+			for (uint16_t i = 0; i < NUM_OSCILS; ++i) {
+				const int16_t amplitude = amplitudes[i];
+				if (!amplitude) {
+					phases[i] += increments[i] * chunk;
+					continue;
+				}
+				uint32_t phase = phases[i];
+				const uint32_t increment = increments[i];
+				for (uint16_t j = 0; j < chunk; ++j) {
+					phase += increment;
+					sums[j] += (int16_t) FLASH_OR_RAM_READ<const int8_t>(tab + ((phase >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1))) * amplitude;
+				}
+				phases[i] = phase;
+			}
+			for (uint16_t j = 0; j < chunk; ++j) dst[j] = sums[j] >> 8;
+			dst += chunk;
+			n -= chunk;
+		}
+	}
+
+
+private:
+	static const uint16_t FILL_CHUNK = 32;
+
+	uint32_t phases[NUM_OSCILS];
+	uint32_t increments[NUM_OSCILS];
+	uint8_t amplitudes[NUM_OSCILS];
+	const int8_t * table;
+};
+
+/**
+@example 06.Synthesis/Additive_OscilBank/Additive_OscilBank.ino
+This is an example of additive synthesis with OscilBank.
+*/
+
+#endif /* OSCILBANK_H_ */
@@ -0,0 +1,224 @@
+/*
+ * PolyBLEP.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef POLYBLEP_H_
+#define POLYBLEP_H_
+
+#include "Arduino.h"
+#include "MozziHeadersOnly.h"
+#include "mozzi_fixmath.h"
+#include "Oscil.h"
+
+enum polyblep_waveform {POLYBLEP_SAW, POLYBLEP_SQUARE, POLYBLEP_TRIANGLE};
+
+/**
+PolyBLEPOscil generates sawtooth, square (pulse), and triangle waves, with much less aliasing than a naive waveform (or a plain wavetable),
+without needing any tables at all. This makes it a light weight alternative to the band limited tables in tables/BandLimited_* (and MetaOscil),
+and unlike those, it supports continuously variable pulse width (PWM).
+
+The naive waveform is corrected around each discontinuity with a short polynomial (PolyBLEP, for the jumps in sawtooth and square), or around each
+corner with its integral (PolyBLAMP, for the triangle). This costs a few multiplications in the two samples around each jump or corner, only.
+Aliasing is not removed entirely, but pushed down considerably, esp. for lower harmonics.
+
+The phase works the same as in Oscil, as if playing a table of 65536 cells, i.e. a whole cycle is 2^32, the upper 16 bits being the index and
+the lower OSCIL_F_BITS bits the fraction. Thus, getPhaseFractional() and setPhaseFractional() can be used to sync a PolyBLEPOscil to an
+Oscil<65536, UPDATE_RATE> (or to another PolyBLEPOscil).
+
+@tparam UPDATE_RATE MOZZI_AUDIO_RATE, typically.
+@tparam WAVEFORM POLYBLEP_SAW (rising), POLYBLEP_SQUARE (with pulse width, see setPulseWidth()), or POLYBLEP_TRIANGLE.
+
+@note Samples are returned in 16 bit resolution, use e.g. MonoOutput::from16Bit().
+*/
+template <uint16_t UPDATE_RATE, uint8_t WAVEFORM = POLYBLEP_SAW>
+class PolyBLEPOscil
+{
+
+public:
+	/** Constructor. */
+	PolyBLEPOscil(): phase_fractional(0), pulse_width_fractional(0x80000000UL)
+	{
+		setPhaseInc(0);
+	}
+
+
+	/** Updates the phase according to the current frequency and returns the sample at the new phase position.
+	@return the next sample, between -32768 and 32767.
+	*/
+	inline
+	int16_t next()
+	{
+		phase_fractional += phase_increment_fractional;
+		int32_t out;
+		if (WAVEFORM == POLYBLEP_SAW) {
+			out = (int32_t) (phase_fractional >> 16) - 32768;
+			out -= blep(phase_fractional);
+		} else if (WAVEFORM == POLYBLEP_SQUARE) {
+			uint32_t falling = phase_fractional - pulse_width_fractional;  // phase relative to the falling edge
+			out = (phase_fractional < pulse_width_fractional) ? 32767 : -32768;
+			out += blep(phase_fractional);
+			out -= blep(falling);
+		} else {
+			// peak at phase 0, trough at phase 0.5
+			uint16_t p = phase_fractional >> 16;
+			out = (int32_t) ((p < 32768) ? (32767 - p) : (p - 32768)) * 2 - 32767;
+			out -= blamp(phase_fractional);
+			out += blamp(phase_fractional + 0x80000000UL);
+		}
+		if (out > 32767) out = 32767;
+		if (out < -32768) out = -32768;
+		return out;
+	}
+
+
+	/** Set the oscillator frequency with an unsigned int.
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(int frequency)
+	{
+		setPhaseInc((uint32_t) frequency * INCREMENT_PER_HZ);
+	}
+
+
+	/** Set the oscillator frequency with a float.
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(float frequency)
+	{
+		setPhaseInc((uint32_t) (frequency * (4294967296.f / UPDATE_RATE)));
+	}
+
+
+	/** Set the frequency using Q16n16 fixed-point number format, e.g. from Q16n16_mtof().
+	@param frequency in Q16n16 fixed-point number format.
+	*/
+	inline
+	void setFreq_Q16n16(Q16n16 frequency)
+	{
+		setPhaseInc(((uint64_t) frequency * INCREMENT_PER_HZ) >> 16);
+	}
+
+
+	/** Set the frequency using UFix<NI,NF> fixed-point number format.
+	@param frequency in UFix<NI,NF> fixed-point number format.
+	*/
+	template <int8_t NI, int8_t NF, uint64_t RANGE>
+	inline
+	void setFreq(UFix<NI,NF,RANGE> frequency)
+	{
+		setFreq_Q16n16(UFix<16,16>(frequency).asRaw());
+	}
+
+
+	/** Set the pulse width. Only used for POLYBLEP_SQUARE.
+	@param width fraction of the cycle spent high, from 0 to 65535, where 32768 is a square wave.
+	*/
+	inline
+	void setPulseWidth(uint16_t width)
+	{
+		pulse_width_fractional = (uint32_t) width << 16;
+	}
+
+
+	/** Set a specific phase increment, e.g. for sliding between frequencies. See phaseIncFromFreq().
+	@param phaseinc_fractional the phase increment, i.e. the fraction of a cycle per sample, in units of 2^-32.
+	*/
+	inline
+	void setPhaseInc(uint32_t phaseinc_fractional)
+	{
+		phase_increment_fractional = phaseinc_fractional;
+		// Reciprocal of the increment, for normalizing the distance to an edge without dividing in next()
+		inverse_increment = (phaseinc_fractional > 1) ? (0xFFFFFFFFUL / phaseinc_fractional) : 0xFFFFFFFFUL;
+	}
+
+
+	/** Calculate the phase increment for a frequency, for use with setPhaseInc().
+	@param frequency in Hz
+	@return the phase increment value which will produce the given frequency.
+	*/
+	inline
+	uint32_t phaseIncFromFreq(int frequency)
+	{
+		return (uint32_t) frequency * INCREMENT_PER_HZ;
+	}
+
+
+	/** Set the phase, in the same format as Oscil::setPhaseFractional(), for a table of 65536 cells.
+	@param phase a position in the cycle, where 2^32 is one cycle.
+	*/
+	inline
+	void setPhaseFractional(uint32_t phase)
+	{
+		phase_fractional = phase;
+	}
+
+
+	/** Get the phase, in the same format as Oscil::getPhaseFractional(), for a table of 65536 cells.
+	@return position in the cycle, where 2^32 is one cycle.
+	*/
+	inline
+	uint32_t getPhaseFractional()
+	{
+		return phase_fractional;
+	}
+
+
+private:
+	static const uint32_t INCREMENT_PER_HZ = 4294967296ULL / UPDATE_RATE;
+
+	/* Distance from phase 0 (forward, if phase is within one increment after it, or backward, if within one increment before it),
+	 * normalized to the increment, and subtracted from 1. In Q15: 32768 right at the edge, falling to 0 one sample away. 0 if further away. */
+	inline
+	int32_t edgeProximity(uint32_t phase)
+	{
+		if (phase < phase_increment_fractional) {
+			return 32768 - (int32_t) ((phase * inverse_increment) >> 17);
+		} else if ((uint32_t) -phase < phase_increment_fractional) {
+			return 32768 - (int32_t) (((uint32_t) -phase * inverse_increment) >> 17);
+		}
+		return 0;
+	}
+
+	/* Residual of a band limited step (of height 2, i.e. full scale) at phase 0, in Q15:
+	 * -(1-x)^2 just after the step, (1-x)^2 just before it. */
+	inline
+	int32_t blep(uint32_t phase)
+	{
+		int32_t d = edgeProximity(phase);
+		if (!d) return 0;
+		int32_t square = (d * d) >> 15;
+		return (phase < phase_increment_fractional) ? -square : square;
+	}
+
+	/* Residual of a band limited ramp at phase 0, for a change of slope of 8 (full scale, up and down, per cycle, as in a triangle),
+	 * in Q15: (1-x)^3 / 3 * 8 * increment, on both sides. */
+	inline
+	int32_t blamp(uint32_t phase)
+	{
+		int32_t d = edgeProximity(phase);
+		if (!d) return 0;
+		int32_t cube = (((d * d) >> 15) * d) >> 15;
+		return (((cube * (int32_t) (phase_increment_fractional >> 17)) >> 15) * (8 * 10923L)) >> 15;  // 10923 / 32768 = 1/3
+	}
+
+	uint32_t phase_fractional;
+	uint32_t phase_increment_fractional;
+	uint32_t inverse_increment;
+	uint32_t pulse_width_fractional;
+};
+
+/**
+@example 06.Synthesis/PolyBLEP_PWM/PolyBLEP_PWM.ino
+This is an example of PolyBLEPOscil, with pulse width modulation.
+*/
+
+#endif /* POLYBLEP_H_ */
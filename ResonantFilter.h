@@ -15,6 +15,7 @@
 #include "IntegerType.h"
 #include "AudioOutput.h"
 #include "meta.h"
+#include "mozzi_profile.h"
 
 
 
@@ -122,11 +123,11 @@ public:
   /** Calculate the next sample, given an input signal.
   @param in the signal input. Should not be more than 8bits on 8bits platforms (Arduino) if using the 8bits version and not 16bits version.
   @return the signal output.
-  @note Timing: about 11us.
+  @note To measure the cost of this on your board, see @ref MOZZI_PROFILER.
   */
-  //	10.5 to 12.5 us, mostly 10.5 us (was 14us)
   inline AudioOutputStorage_t next(AudioOutputStorage_t in)
   {
+    MOZZI_PROFILE_SCOPE("ResonantFilter::next");
     advanceBuffers(in);
     return current(in, Int2Type<FILTER_TYPE>());
   }
@@ -13,6 +13,7 @@
 #define REVERBTANK_H
 
 #include "AudioDelay.h"
+#include "mozzi_profile.h"
 /**
 A reverb which sounds like the inside of a tin can.
 ReverbTank is small enough to fit on the Arduino Nano, which for some reason
@@ -63,6 +64,7 @@ public:
 	@return the processed signal
 	*/
 	int next(int input){
+		MOZZI_PROFILE_SCOPE("ReverbTank::next");
 		static int recycle1, recycle2;
 
 		// early reflections
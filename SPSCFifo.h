@@ -0,0 +1,139 @@
+/*
+ * SPSCFifo.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef SPSCFIFO_H_
+#define SPSCFIFO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/** Alignment of the read and write indices of SPSCFifo. On the desktop, the two indices are placed on separate cache lines, so the two
+cores do not keep invalidating each other's cache, on every single access. The supported dual core microcontrollers have no data cache
+for internal RAM, so padding would only waste RAM, there. */
+#if !defined(SPSCFIFO_INDEX_ALIGNMENT)
+#  if defined(ARDUINO)
+#    define SPSCFIFO_INDEX_ALIGNMENT 4
+#  else
+#    define SPSCFIFO_INDEX_ALIGNMENT 64
+#  endif
+#endif
+
+/** @ingroup util
+Wait-free single producer, single consumer FIFO. This offers the same interface as CircularBuffer, but
+is safe to use, when the producer and the consumer run on different cores (or threads), e.g. to pass audio from the core
+running updateAudio() to the core (or interrupt) sending it to the DAC.
+
+The rules are:
+  - Only one thread (the producer) may call isFull(), freeSpace(), contiguousFreeSpace(), write(), writeAddress(), and advanceWrite().
+  - Only one thread (the consumer) may call isEmpty() and read(). read() must only be called, if isEmpty() returned false.
+  - count() and available() may be called from anywhere.
+
+Items are published with release semantics, and picked up with acquire semantics, so an item is fully written before the consumer can
+see it, and fully read before the producer can overwrite it. Neither side ever waits on the other.
+
+Requires std::atomic, and is thus not available on AVR.
+
+@tparam ITEM_TYPE the kind of data to store, eg. int, int8_t etc.
+@tparam NUM_ITEMS the number of cells. Must be a power of two, between 2 and 32768.
+*/
+template <class ITEM_TYPE, uint16_t NUM_ITEMS = 256>
+class SPSCFifo
+{
+	static_assert((NUM_ITEMS & (NUM_ITEMS - 1)) == 0 && NUM_ITEMS > 1, "Size of SPSCFifo must be a power of two");
+
+public:
+	/** Constructor
+	*/
+	SPSCFifo(): read_index(0), write_index(0)
+	{
+	}
+
+	inline
+	bool isFull() {
+		return (write_index.load(std::memory_order_relaxed) - read_index.load(std::memory_order_acquire)) >= NUM_ITEMS;
+	}
+
+	inline
+	bool isEmpty() {
+		return read_index.load(std::memory_order_relaxed) == write_index.load(std::memory_order_acquire);
+	}
+
+	inline
+	void write(ITEM_TYPE in) {
+		uint32_t w = write_index.load(std::memory_order_relaxed);
+		items[w & (NUM_ITEMS - 1)] = in;
+		write_index.store(w + 1, std::memory_order_release);
+	}
+
+	/** Read the oldest item. The FIFO must not be empty: check isEmpty(), first. Reading from an empty FIFO would move the read index past
+	the write index, after which the FIFO would appear full, forever. */
+	inline
+	ITEM_TYPE read() {
+		uint32_t r = read_index.load(std::memory_order_relaxed);
+		ITEM_TYPE out = items[r & (NUM_ITEMS - 1)];
+		read_index.store(r + 1, std::memory_order_release);
+		return out;
+	}
+
+	/** Number of items that can be written before the buffer is full */
+	inline
+	uint16_t freeSpace() {
+		return NUM_ITEMS - (write_index.load(std::memory_order_relaxed) - read_index.load(std::memory_order_acquire));
+	}
+
+	/** Number of items that can be written to writeAddress() in one go, i.e. without wrapping around the end of the buffer */
+	inline
+	uint16_t contiguousFreeSpace() {
+		uint16_t to_end = NUM_ITEMS - (write_index.load(std::memory_order_relaxed) & (NUM_ITEMS - 1));
+		uint16_t free = freeSpace();
+		return (free < to_end) ? free : to_end;
+	}
+
+	/** Address of the next item to be written. Use together with contiguousFreeSpace() and advanceWrite() to write several items directly into the buffer */
+	inline
+	ITEM_TYPE * writeAddress() {
+		return items + (write_index.load(std::memory_order_relaxed) & (NUM_ITEMS - 1));
+	}
+
+	/** Publish n items, written at writeAddress(). n must not exceed contiguousFreeSpace() */
+	inline
+	void advanceWrite(uint16_t n) {
+		write_index.store(write_index.load(std::memory_order_relaxed) + n, std::memory_order_release);
+	}
+
+	/** Number of items waiting to be read. When called by neither the producer nor the consumer, this is only a snapshot, of course. */
+	inline
+	uint16_t available() {
+		uint32_t r = read_index.load(std::memory_order_acquire);  // first: the read index can never overtake a write index loaded later
+		return write_index.load(std::memory_order_acquire) - r;
+	}
+
+	/** Total number of items read so far (wrapping around at 2^32) */
+	inline
+	unsigned long count() {
+		return read_index.load(std::memory_order_relaxed);
+	}
+
+	inline
+	ITEM_TYPE * address() {
+		return items;
+	}
+
+private:
+	// Both indices are free running, and only masked on access to items. Thus full and empty can be told apart without extra flags,
+	// and each index is written by one side, only.
+	alignas(SPSCFIFO_INDEX_ALIGNMENT) std::atomic<uint32_t> read_index;   // written by the consumer
+	alignas(SPSCFIFO_INDEX_ALIGNMENT) std::atomic<uint32_t> write_index;  // written by the producer
+	alignas(SPSCFIFO_INDEX_ALIGNMENT) ITEM_TYPE items[NUM_ITEMS];
+};
+
+#endif        //  #ifndef SPSCFIFO_H_
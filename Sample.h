@@ -15,6 +15,7 @@
 #include "MozziHeadersOnly.h"
 #include "mozzi_fixmath.h"
 #include "mozzi_pgmspace.h"
+#include "mozzi_utils.h"
 
 // fractional bits for sample index precision
 #define SAMPLE_F_BITS 16
@@ -24,8 +25,6 @@
 // the fractional part and the sign bit
 #define SAMPLE_PHMOD_BITS 16
 
-enum interpolation {INTERP_NONE, INTERP_LINEAR};
-
 /** Sample is like Oscil, it plays a wavetable.  However, Sample can be
 set to play once through only, with variable start and end points,
 or can loop, also with variable start and end points.
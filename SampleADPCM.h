@@ -0,0 +1,283 @@
+/*
+ * SampleADPCM.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef SAMPLEADPCM_H_
+#define SAMPLEADPCM_H_
+
+#include "Arduino.h"
+#include "mozzi_pgmspace.h"
+#include "mozzi_profile.h"
+
+namespace MozziPrivate {
+// The standard IMA ADPCM tables
+CONSTTABLE_STORAGE(uint16_t) adpcm_step_table[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+	157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552,
+	1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+	12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+CONSTTABLE_STORAGE(int8_t) adpcm_index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+}
+
+/** SampleADPCM plays samples compressed with IMA ADPCM, at 4 bits per sample, i.e. in half the flash needed by an 8 bit Sample,
+or a quarter of that of a 16 bit sample. Unlike SampleHuffman, decoding takes the same (short) time for every sample, and
+playback can start from any position quickly.
+
+The sample data is made of blocks of BLOCK_SAMPLES samples. Each block starts with a header of three bytes: the predicted
+value (int16_t, little endian), and the step index of the decoder, at the first sample of the block, followed by
+BLOCK_SAMPLES / 2 bytes with one sample per 4 bits, the low nibble first. The last block may be shorter. Thanks to the
+headers, playback can start at any block without decoding the sample from the beginning, and errors do not accumulate
+beyond a block.
+
+Sample files can be made with the Python script adpcm2mozzi.py, in Mozzi/extras/python/, from a WAV file
+(8 or 16 bit, mono or stereo), or from raw signed 8 bit data, like for char2mozzi.py:
+@code
+python3 adpcm2mozzi.py sound.wav sound_adpcm.h SOUND
+@endcode
+
+@tparam BLOCK_SAMPLES number of samples per block, a power of two, which must match the BLOCK_SAMPLES of the sample file.
+Larger blocks have less overhead (3 bytes per block), smaller blocks allow faster seeking with start(offset) and setStart().
+*/
+template <uint16_t BLOCK_SAMPLES = 256>
+class SampleADPCM
+{
+	static_assert((BLOCK_SAMPLES >= 2) && ((BLOCK_SAMPLES & (BLOCK_SAMPLES - 1)) == 0), "BLOCK_SAMPLES must be a power of two");
+
+public:
+	/** Constructor.
+	@param DATA the name of the DATA table in the ADPCM sample .h file
+	@param NUM_CELLS the NUM_CELLS from the ADPCM sample .h file, i.e. the number of samples
+	*/
+	SampleADPCM(const uint8_t * DATA, uint32_t NUM_CELLS)
+	{
+		setLoopingOff();
+		setTable(DATA, NUM_CELLS);
+	}
+
+
+	/** Constructor, without sample data. Set it with setTable(), before playing.
+	*/
+	SampleADPCM()
+	{
+		setLoopingOff();
+		setTable(nullptr, 0);
+	}
+
+
+	/** Change the sample to play. This resets the start and end positions to the whole sample, and the playhead to the beginning.
+	@param DATA the name of the DATA table in the ADPCM sample .h file
+	@param NUM_CELLS the NUM_CELLS from the ADPCM sample .h file
+	*/
+	void setTable(const uint8_t * DATA, uint32_t NUM_CELLS)
+	{
+		data = DATA;
+		num_cells = NUM_CELLS;
+		ptr = DATA;
+		samplepos = 0;
+		predicted = 0;
+		step_index = 0;
+		nibbles = 0;
+		rangeWholeSample();
+		start();
+	}
+
+
+	/** Sets the starting position in samples, for start() and looping. This decodes at most BLOCK_SAMPLES - 1 samples, once.
+	@param startpos offset position in samples.
+	*/
+	void setStart(uint32_t startpos)
+	{
+		if (startpos > num_cells) startpos = num_cells;
+		start_samplepos = startpos;
+		const int16_t playing_predicted = predicted;
+		const uint8_t playing_step_index = step_index, playing_nibbles = nibbles;
+		const uint8_t * playing_ptr = ptr;
+		const uint32_t playing_samplepos = samplepos;
+		seek(startpos);
+		start_predicted = predicted;
+		start_step_index = step_index;
+		start_nibbles = nibbles;
+		start_ptr = ptr;
+		predicted = playing_predicted;
+		step_index = playing_step_index;
+		nibbles = playing_nibbles;
+		ptr = playing_ptr;
+		samplepos = playing_samplepos;
+	}
+
+
+	/** Sets the playhead to the start position, which is the beginning of the sample, unless set to another value with setStart().
+	*/
+	inline
+	void start()
+	{
+		samplepos = start_samplepos;
+		predicted = start_predicted;
+		step_index = start_step_index;
+		nibbles = start_nibbles;
+		ptr = start_ptr;
+	}
+
+
+	/** Sets a new start position and plays the sample from that position.
+	@param startpos position in samples from the beginning of the sound.
+	*/
+	void start(uint32_t startpos)
+	{
+		setStart(startpos);
+		start();
+	}
+
+
+	/** Sets the end position in samples from the beginning of the sound.
+	@param end position in samples.
+	*/
+	inline
+	void setEnd(uint32_t end)
+	{
+		endpos = (end < num_cells) ? end : num_cells;
+	}
+
+
+	/** Sets the start and end points to include the whole sample.
+	*/
+	inline
+	void rangeWholeSample()
+	{
+		setStart(0);
+		endpos = num_cells;
+	}
+
+
+	/** Turns looping on.
+	*/
+	inline
+	void setLoopingOn()
+	{
+		looping = true;
+	}
+
+
+	/** Turns looping off.
+	*/
+	inline
+	void setLoopingOff()
+	{
+		looping = false;
+	}
+
+
+	/** Checks if the sample is playing, i.e. the playhead has not reached the end position.
+	@return true if the sample is playing
+	*/
+	inline
+	bool isPlaying()
+	{
+		return samplepos < endpos;
+	}
+
+
+	/** Decodes and returns the next sample, or 0 if looping is off and the end position has been reached.
+	@return the next sample, in 16 bit resolution, use e.g. MonoOutput::from16Bit().
+	*/
+	inline
+	int16_t next()
+	{
+		MOZZI_PROFILE_SCOPE("SampleADPCM::next");
+		if (!isPlaying()) {
+			if (looping) {
+				start();
+				if (!isPlaying()) return 0;  // empty loop range, e.g. start at the end of the sample
+			} else {
+				return 0;
+			}
+		}
+		if (!(samplepos & (BLOCK_SAMPLES - 1))) readHeader();
+		step();
+		return predicted;
+	}
+
+
+private:
+	static const uint16_t BLOCK_BYTES = 3 + BLOCK_SAMPLES / 2;
+
+	// Move to the start of the block holding samplepos, and take the decoder state from its header
+	inline
+	void readHeader()
+	{
+		ptr = data + (samplepos / BLOCK_SAMPLES) * BLOCK_BYTES;
+		predicted = FLASH_OR_RAM_READ<const uint8_t>(ptr) | ((uint16_t) FLASH_OR_RAM_READ<const uint8_t>(ptr + 1) << 8);
+		step_index = FLASH_OR_RAM_READ<const uint8_t>(ptr + 2);
+		ptr += 3;
+	}
+
+	// Decode one sample: the same number of steps for any data
+	inline
+	void step()
+	{
+		uint8_t nibble;
+		if (samplepos & 1) {
+			nibble = nibbles >> 4;
+		} else {
+			nibbles = FLASH_OR_RAM_READ<const uint8_t>(ptr++);
+			nibble = nibbles & 15;
+		}
+		const uint16_t step_size = FLASH_OR_RAM_READ<const uint16_t>(MozziPrivate::adpcm_step_table + step_index);
+		uint16_t difference = step_size >> 3;
+		if (nibble & 4) difference += step_size;
+		if (nibble & 2) difference += step_size >> 1;
+		if (nibble & 1) difference += step_size >> 2;
+		int32_t value = (nibble & 8) ? (int32_t) predicted - difference : (int32_t) predicted + difference;
+		if (value > 32767) value = 32767;
+		else if (value < -32768) value = -32768;
+		predicted = value;
+		int8_t index = step_index + FLASH_OR_RAM_READ<const int8_t>(MozziPrivate::adpcm_index_table + (nibble & 7));
+		if (index < 0) index = 0;
+		else if (index > 88) index = 88;
+		step_index = index;
+		samplepos++;
+	}
+
+	// Move the decoder to a sample position: to the start of its block, then decode up to it
+	void seek(uint32_t pos)
+	{
+		MOZZI_PROFILE_SCOPE("SampleADPCM::seek");
+		samplepos = pos & ~(uint32_t) (BLOCK_SAMPLES - 1);
+		if (!data || (samplepos >= num_cells)) {
+			// nothing to decode, but keep the state consistent
+			samplepos = pos;
+			ptr = data;
+			predicted = 0;
+			step_index = 0;
+			return;
+		}
+		readHeader();
+		while (samplepos < pos) step();
+		// the next sample, if at the start of a block, is decoded after reading that block's header in next()
+	}
+
+	const uint8_t * data;
+	const uint8_t * ptr;
+	const uint8_t * start_ptr;
+	uint32_t num_cells;
+	uint32_t samplepos, start_samplepos, endpos;
+	int16_t predicted, start_predicted;
+	uint8_t step_index, start_step_index;
+	uint8_t nibbles, start_nibbles; // the byte holding the current pair of samples
+	bool looping;
+};
+
+/**
+@example 08.Samples/Sample_ADPCM/Sample_ADPCM.ino
+This is an example of SampleADPCM, playing a compressed sample.
+*/
+
+#endif /* SAMPLEADPCM_H_ */
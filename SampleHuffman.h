@@ -12,7 +12,10 @@
 #ifndef SAMPLEHUFFMAN_H
 #define SAMPLEHUFFMAN_H
 
+#include "mozzi_fixmath.h"
+#include "FixMath.h"
 #include "mozzi_pgmspace.h"
+#include "mozzi_profile.h"
 
 /** A sample player for samples encoded with Huffman compression.
 
@@ -22,9 +25,13 @@ an Arduino sketch by Thomas Grill, 2011 http//grrrr.org
 Huffman decoding is used on sample differentials,
 saving 50-70% of space for 8 bit data, depending on the sample rate.
 
-This implementation just plays back one sample each time next() is called, with no
-speed or other adjustments.
-It's slow, so it's likely you will only be able to play one sound at a time.
+By default, this implementation just plays back one sample each time next() is called.
+For playing at other speeds (pitches), see setSpeed().
+Walking the Huffman tree one bit at a time is slow, and the time taken varies with the
+data, so it's likely you will only be able to play one sound at a time. If the header file
+also contains a "HUFFMAN_LUT" lookup table (generated by audio2huff.py, by default),
+pass it to the constructor, too: Most samples will then be decoded with a single lookup of
+up to 8 bits at once, which is much faster, and nearly constant in time.
 
 Audio data, Huffman decoder table, sample rate and bit depth are defined
 in a sounddata.h header file.  This file can be generated for a sound file with the 
@@ -44,6 +51,15 @@ Other uncompressed files, Header: WAV(Microsoft), Encoding: Unsigned 8 bit PCM
 The header file contains two lengthy arrays:
 One is "SOUNDDATA" which must fit into Flash RAM (available in total: 32k for ATMega328)
 The other is "HUFFMAN" which must also fit into Flash RAM
+The optional "HUFFMAN_LUT" takes another 4 * 2^HUFFMAN_LUT_BITS bytes of Flash RAM (1k for 8 bits).
+See the --lutbits option of audio2huff.py to trade speed for size.
+
+Since each sample is stored as the difference to the previous one, with codes of varying length, playback
+can not simply jump to any position in the stream. For playing from an offset (start(offset)), or looping
+a part of the sample (setStart(), setEnd()), the stream is decoded from the beginning up to the position.
+For long samples, this is slow, but audio2huff.py also writes a "SEEK" index of checkpoints, every
+SEEK_INTERVAL samples (see its --seekinterval option). Passing that to setSeekIndex() limits the
+decoding to at most SEEK_INTERVAL samples. This allows e.g. playing slices of a compressed drum loop.
 
 */
 
@@ -56,36 +72,102 @@ public:
 	@param SOUNDDATA the name of the SOUNDDATA table in the huffman sample .h file
 	@param HUFFMAN_DATA the name of the HUFFMAN table in the huffman sample .h file
 	@param	SOUNDDATA_BITS from the huffman sample .h file
+	@param HUFFMAN_LUT the name of the HUFFMAN_LUT table in the huffman sample .h file, if any, for faster decoding
+	@param HUFFMAN_LUT_BITS the HUFFMAN_LUT_BITS from the huffman sample .h file, if using HUFFMAN_LUT
 	*/
-	SampleHuffman(uint8_t const * SOUNDDATA, int16_t const * HUFFMAN_DATA, uint32_t const SOUNDDATA_BITS):sounddata(SOUNDDATA),huffman(HUFFMAN_DATA),sounddata_bits(SOUNDDATA_BITS)
+	SampleHuffman(uint8_t const * SOUNDDATA, int16_t const * HUFFMAN_DATA, uint32_t const SOUNDDATA_BITS, int16_t const * HUFFMAN_LUT = nullptr, uint8_t const HUFFMAN_LUT_BITS = 0):sounddata(SOUNDDATA),huffman(HUFFMAN_DATA),sounddata_bits(SOUNDDATA_BITS),lut(HUFFMAN_LUT),lut_bits(HUFFMAN_LUT_BITS)
 	{
 		setLoopingOff();
+		seek_bits = nullptr;
+		seek_values = nullptr;
+		seek_interval = 0;
+		num_samples = 0xFFFFFFFFUL;
+		speed = 0x10000UL;
+		pitched = false;
+		rangeWholeSample();
+		start();
+	}
+
+
+	/** Use the seek index from the huffman sample .h file, for fast positioning with start(offset), setStart() and setEnd().
+	@param SEEK_BITS the name of the SEEK_BITS table in the huffman sample .h file
+	@param SEEK_VALUES the name of the SEEK_VALUES table in the huffman sample .h file
+	@param SEEK_INTERVAL the SEEK_INTERVAL from the huffman sample .h file
+	@param NUM_SAMPLES the NUM_SAMPLES from the huffman sample .h file
+	*/
+	void setSeekIndex(uint32_t const * SEEK_BITS, int16_t const * SEEK_VALUES, uint16_t const SEEK_INTERVAL, uint32_t const NUM_SAMPLES)
+	{
+		seek_bits = SEEK_BITS;
+		seek_values = SEEK_VALUES;
+		seek_interval = SEEK_INTERVAL;
+		num_samples = NUM_SAMPLES;
+	}
+
+
+	/** Set the playback speed, relative to one sample per call of next().
+	At any speed other than 1, next() interpolates linearly between the last two decoded samples, and decodes as many
+	samples as the speed requires, only, i.e. the cost of next() grows with the speed.
+	@param speed in Q8n8 fixed-point format, e.g. 256 for the original speed, 128 for half the speed (an octave down),
+	512 for twice the speed (an octave up).
+	*/
+	inline
+	void setSpeed(Q8n8 speed)
+	{
+		setSpeed(UFix<8,8>::fromRaw(speed));
 	}
 
 
-	/** Update and return the next audio sample.  So far it just plays back one sample at a time without any variable tuning or speed.
+	/** Set the playback speed, in UFix<NI,NF> fixed-point format, see setSpeed(Q8n8). Fractional bits beyond 16 are ignored.
+	@param speed relative to one sample per call of next()
+	*/
+	template <int8_t NI, int8_t NF, uint64_t RANGE>
+	inline
+	void setSpeed(UFix<NI,NF,RANGE> speed)
+	{
+		this->speed = UFix<16,16>(speed).asRaw();
+		const bool was_pitched = pitched;
+		pitched = (this->speed != 0x10000UL);
+		if (pitched && !was_pitched) {
+			// continue from the current playhead
+			previous = latest = current;
+			phase_fraction = 0;
+		}
+	}
+
+
+	/** Update and return the next audio sample.
 	@return the next audio sample
-	@note timing: about 5 to 40 us, varies continuously depending on data
+	@note Without HUFFMAN_LUT, timing varies continuously depending on data. With it, only codes longer than HUFFMAN_LUT_BITS
+	(rare, for typical samples) take extra time. To measure the cost of this on your board, see @ref MOZZI_PROFILER.
 	*/
 	inline
 	int16_t next()
 	{
-		if(datapos >= sounddata_bits){
-			if(looping){
-				// at end of sample, restart from zero, looping the sound
-				 datapos = 0;
-			}else{
-				return 0;
-			}
+		if (!pitched) return step();
+
+		// interpolate between the last two decoded samples, then move the phase on, decoding as many samples as it has passed
+		const int16_t out = previous + (int16_t) (((int32_t) (latest - previous) * (phase_fraction >> 1)) >> 15);
+		const uint32_t phase = (uint32_t) phase_fraction + speed;
+		phase_fraction = phase;
+		for (uint16_t n = phase >> 16; n; --n) {
+			previous = latest;
+			latest = step();
 		}
-		
-		int16_t dif = decode();
-		current += dif; // add differential
-		return current;
+		return out;
+	}
+
+
+	/** Checks if the sample is playing, i.e. the playhead has not reached the end of the sample, or the end position.
+	@return true if the sample is playing
+	*/
+	inline
+	bool isPlaying()
+	{
+		return (samplepos < endpos) && (datapos < sounddata_bits);
 	}
 
 
-	/** Turns looping on, with the whole sample length as the loop range.
+	/** Turns looping on, with the range from the start position to the end position, by default the whole sample.
 	*/
 	inline
 	void setLoopingOn()
@@ -102,24 +184,138 @@ public:
 		looping=false;
 	}
 
-	/** Sets the playhead to the beginning of the sample.
+	/** Sets the starting position in samples, for start() and looping. This decodes the stream up to the position, once, see setSeekIndex().
+	@param startpos offset position in samples.
+	*/
+	void setStart(uint32_t startpos)
+	{
+		const uint32_t playing_datapos = datapos, playing_samplepos = samplepos;
+		const int16_t playing_current = current;
+		seek(startpos);
+		start_datapos = datapos;
+		start_samplepos = samplepos;
+		start_current = current;
+		jump(playing_datapos, playing_samplepos, playing_current);
+	}
+
+
+	/** Sets the playhead to the start position, which is the beginning of the sample, unless set to another value with setStart().
 	*/
 	inline
 	void start()
 	{
-		current = 0;
-		datapos = 0;
-		bt = 0;
+		restart();
+		previous = latest = current;
+		phase_fraction = 0;
+	}
+
+
+	/** Sets a new start position and plays the sample from that position.
+	@param startpos position in samples from the beginning of the sound.
+	*/
+	void start(uint32_t startpos)
+	{
+		setStart(startpos);
+		start();
+	}
+
+
+	/** Sets the end position in samples from the beginning of the sound.
+	@param end position in samples.
+	*/
+	inline
+	void setEnd(uint32_t end)
+	{
+		endpos = end;
+	}
+
+
+	/** Sets the start and end points to include the whole sample.
+	*/
+	inline
+	void rangeWholeSample()
+	{
+		start_datapos = 0;
+		start_samplepos = 0;
+		start_current = 0;
+		endpos = 0xFFFFFFFFUL;
 	}
 	
 private:
 	uint8_t const * sounddata;
 	int16_t const * huffman;
 	uint32_t const sounddata_bits;
-	uint32_t datapos; // current sample position
+	int16_t const * lut;
+	uint8_t const lut_bits;
+	uint32_t const * seek_bits;
+	int16_t const * seek_values;
+	uint16_t seek_interval;
+	uint32_t num_samples;
+	uint32_t datapos; // current position in the bit stream
+	uint32_t samplepos; // current sample position
 	int16_t current; // current amplitude value
+	uint32_t start_datapos, start_samplepos, endpos;
+	int16_t start_current;
 	bool looping;
 	uint8_t bt;
+	uint32_t speed; // Q16n16
+	uint16_t phase_fraction; // position between the previous and the latest sample
+	int16_t previous, latest; // the last two decoded samples, when pitched
+	bool pitched;
+
+	// Decode and return one sample, or 0 at the end of the sample, unless looping
+	inline
+	int16_t step()
+	{
+		if(!isPlaying()){
+			if(looping){
+				// at end of sample (or loop range), restart from the start position, looping the sound
+				restart();
+				if(!isPlaying()) return 0; // empty loop range, e.g. start at the end of the sample
+			}else{
+				return 0;
+			}
+		}
+		
+		int16_t dif = lut ? decodeTable() : decode();
+		current += dif; // add differential
+		samplepos++;
+		return current;
+	}
+
+	inline
+	void restart()
+	{
+		jump(start_datapos, start_samplepos, start_current);
+	}
+
+	// Move the playhead to a decoder state
+	inline
+	void jump(uint32_t to_datapos, uint32_t to_samplepos, int16_t to_current)
+	{
+		datapos = to_datapos;
+		samplepos = to_samplepos;
+		current = to_current;
+		// getbit() only loads a new byte at byte boundaries
+		if (datapos < sounddata_bits) bt = FLASH_OR_RAM_READ<const uint8_t>(sounddata + (datapos >> 3));
+	}
+
+	// Move the playhead to a sample position, from the closest checkpoint before it, or else from the beginning
+	void seek(uint32_t pos)
+	{
+		MOZZI_PROFILE_SCOPE("SampleHuffman::seek");
+		if (pos > num_samples) pos = num_samples;
+		if (seek_interval) {
+			const uint32_t checkpoint = pos / seek_interval;
+			jump(FLASH_OR_RAM_READ<const uint32_t>(seek_bits + checkpoint), checkpoint * seek_interval, FLASH_OR_RAM_READ<const int16_t>(seek_values + checkpoint));
+		} else {
+			jump(0, 0, 0);
+		}
+		while ((samplepos < pos) && (datapos < sounddata_bits)) {
+			current += lut ? decodeTable() : decode();
+			samplepos++;
+		}
+	}
 	
 	// Get one bit from sound data
 	inline 
@@ -137,7 +333,38 @@ private:
 	inline
 	int16_t decode()
 	{
-		int16_t const * huffcode = huffman;
+		MOZZI_PROFILE_SCOPE("SampleHuffman::decode");
+		return walk(huffman);
+	}
+
+
+	// Decode up to lut_bits bits at once, using the lookup table. Each entry is a pair of
+	// (code length, value) or, for codes longer than lut_bits, (0, position in the Huffman table
+	// after lut_bits bits), from where the rest of the code is decoded one bit at a time.
+	inline
+	int16_t decodeTable()
+	{
+		MOZZI_PROFILE_SCOPE("SampleHuffman::decodeTable");
+		const uint32_t bytepos = datapos >> 3;
+		uint16_t window = (uint16_t) FLASH_OR_RAM_READ<const uint8_t>(sounddata + bytepos) << 8;
+		if (((bytepos + 1) << 3) < sounddata_bits) window |= FLASH_OR_RAM_READ<const uint8_t>(sounddata + bytepos + 1);
+		const uint8_t index = (uint16_t) (window << (datapos & 7)) >> (16 - lut_bits);
+		int16_t const * entry = lut + 2 * index;
+		const int16_t length = FLASH_OR_RAM_READ<const int16_t>(entry);
+		if (length) {
+			datapos += length;
+			return FLASH_OR_RAM_READ<const int16_t>(entry + 1);
+		}
+		datapos += lut_bits;
+		bt = FLASH_OR_RAM_READ<const uint8_t>(sounddata + (datapos >> 3)); // getbit() only loads at byte boundaries
+		return walk(huffman + FLASH_OR_RAM_READ<const int16_t>(entry + 1));
+	}
+
+
+	// Walk the Huffman tree bit by bit, from the given node
+	inline
+	int16_t walk(int16_t const * huffcode)
+	{
 		do {
 			if(getbit()) {
 				const int16_t offs = FLASH_OR_RAM_READ<const int16_t>(huffcode);
@@ -49,6 +49,7 @@ Soc., Vol 45, No. 9, 1997 September
 #include "mozzi_fixmath.h"
 #include "mozzi_utils.h"
 #include "ResonantFilter.h"
+#include "mozzi_profile.h"
 
 //enum filter_types { LOWPASS, BANDPASS, HIGHPASS, NOTCH };
 
@@ -107,9 +108,10 @@ public:
   /** Calculate the next sample, given an input signal.
   @param input the signal input.
   @return the signal output.
-  @note Timing: 16 - 20 us
+  @note To measure the cost of this on your board, see @ref MOZZI_PROFILER.
   */
   inline int next(int input) {
+    MOZZI_PROFILE_SCOPE("StateVariable::next");
     // chooses a different next() function depending on whether the
     // filter is declared as LOWPASS, BANDPASS, HIGHPASS or NOTCH.
     // See meta.h.
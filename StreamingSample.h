@@ -0,0 +1,351 @@
+/*
+ * StreamingSample.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef STREAMINGSAMPLE_H_
+#define STREAMINGSAMPLE_H_
+
+#include "Arduino.h"
+#include "MozziHeadersOnly.h"
+#include "mozzi_pgmspace.h"
+#include "mozzi_profile.h"
+
+#if IS_HOST()
+#include <stdio.h>
+#endif
+#if !IS_AVR()
+#include <atomic>
+#endif
+
+/**
+StreamingSample plays a sample from external storage, such as an SD card, or SPI flash, so samples are not limited by the size of
+the flash memory of the microcontroller. The sample is read block by block into one half of a double buffer in RAM, from
+update(), while the other half is being played by next(). Reading from storage can be slow, and is thus kept out of
+updateAudio(): call update() from loop(), right after audioHook(), or from updateControl().
+
+loop() is preferred, as it is called far more often, so blocks arrive in time with a smaller buffer. update() and next() hand the
+halves of the buffer to each other through atomic flags, so update() may also run on another core, or in another task, than
+updateAudio() (see @ref rp2040_audio_core and @ref esp32_render_task). There must be only one caller of update(), though, and start()
+and stop() reset both sides: call them from updateControl(), and, if update() is called from another core, or task, not while it runs.
+
+The storage is accessed through a block source: any class with a method
+@code
+uint16_t read(uint32_t position, uint8_t * buffer, uint16_t length);
+@endcode
+which copies up to length bytes, starting at byte position of the sample, to buffer, and returns the number of bytes copied. Fewer
+than length bytes (or 0) mark the end of the sample. MemoryBlockSource reads from an array (e.g. for testing), and on the host,
+FileBlockSource reads from a file. For an SD card, with Arduino's SD library, the source could be:
+@code
+class SDBlockSource {
+public:
+  File file;
+  uint16_t read(uint32_t position, uint8_t * buffer, uint16_t length) {
+    file.seek(position);
+    return file.read(buffer, length);
+  }
+};
+@endcode
+
+The sample data is raw signed 8 bit PCM, e.g. as exported from Audacity ("Other uncompressed files", "Header: RAW(headerless)",
+"Encoding: Signed 8 bit PCM"), at MOZZI_AUDIO_RATE.
+
+Each half of the buffer must last long enough to read the next block. If update() is only called from updateControl(), that
+means BUFFER_SIZE must be larger than MOZZI_AUDIO_RATE / MOZZI_CONTROL_RATE samples (256 by default), plus the time the storage
+takes to deliver a block. If the next block is late, the last sample is repeated (avoiding clicks) until it arrives, and
+playback continues where it stopped. To tune the setup, getUnderruns() counts the repeated samples, and getPrefetchMargin() reports
+the closest call: how many samples were left to play when a block arrived, at the least.
+
+@tparam SOURCE the class of the block source.
+@tparam BUFFER_SIZE size of each half of the double buffer, in bytes (samples). Twice that is needed in RAM.
+*/
+template <class SOURCE, uint16_t BUFFER_SIZE = 256>
+class StreamingSample
+{
+
+public:
+	/** Constructor.
+	@param source the block source to read the sample from. Only a reference is kept, so the source must stay valid.
+	*/
+	StreamingSample(SOURCE & source) : source(source), start_position(0), looping(false)
+	{
+		stop();
+		resetStatistics();
+	}
+
+
+	/** Sets the starting position in samples, for start() and looping.
+	@param startpos offset position in samples.
+	*/
+	inline
+	void setStart(uint32_t startpos)
+	{
+		start_position = startpos;
+	}
+
+
+	/** Starts playing from the start position, reading the first block right away. Call this from updateControl(), not updateAudio(),
+	as reading takes time.
+	*/
+	void start()
+	{
+		stop();
+		store(source_done, false);
+		fetch();
+	}
+
+
+	/** Sets a new start position and plays the sample from that position.
+	@param startpos position in samples from the beginning of the sound.
+	*/
+	void start(uint32_t startpos)
+	{
+		setStart(startpos);
+		start();
+	}
+
+
+	/** Stops playing. next() returns 0, until start() is called.
+	*/
+	void stop()
+	{
+		store(filled[0], false);
+		store(filled[1], false);
+		lengths[0] = lengths[1] = 0;
+		playing = 0;
+		store(readpos, (uint16_t) 0);
+		last = 0;
+		fetch_target = 0;
+		fetch_position = start_position;
+		store(source_done, true);
+	}
+
+
+	/** Turns looping on: at the end of the sample, playback continues from the start position.
+	*/
+	inline
+	void setLoopingOn()
+	{
+		looping = true;
+	}
+
+
+	/** Turns looping off.
+	*/
+	inline
+	void setLoopingOff()
+	{
+		looping = false;
+	}
+
+
+	/** Checks if the sample is playing, i.e. there are samples left to play, or to read from the source.
+	@return true if the sample is playing
+	*/
+	inline
+	bool isPlaying()
+	{
+		return !load(source_done) || load(filled[0]) || load(filled[1]);
+	}
+
+
+	/** Reads the next block from the source, if half of the buffer is free. Call this regularly, from loop() (preferred), or
+	updateControl() (see above). At most one block is read per call.
+	*/
+	void update()
+	{
+		MOZZI_PROFILE_SCOPE("StreamingSample::update");
+		if (load(source_done) || load(filled[fetch_target])) return;
+		// the halves are played in turn, so the other one is either being played, or (if empty) already done
+		const uint8_t other = fetch_target ^ 1;
+		const uint16_t pos = load(readpos);
+		if (!load(filled[other])) {
+			min_margin = 0;  // late: next() is already waiting for this block
+		} else {
+			const uint16_t margin = lengths[other] - pos;
+			if (margin < min_margin) min_margin = margin;
+		}
+		fetch();
+	}
+
+
+	/** Returns the next sample from the buffer.
+	@return the next sample, or 0 when not playing. If the next block has not arrived in time, the last sample is repeated.
+	*/
+	inline
+	int8_t next()
+	{
+		if (!load(filled[playing])) {
+			if (!load(source_done)) {
+				++underruns;
+				return last;
+			}
+			if (!load(filled[playing])) return 0;  // source_done is set after handing over the last block, so check once more
+		}
+		uint16_t pos = load(readpos);
+		last = buffers[playing][pos];
+		if (++pos >= lengths[playing]) {
+			// release this half for update(), and move on to the other
+			pos = 0;
+			store(filled[playing], false);
+			playing ^= 1;
+		}
+		store(readpos, pos);
+		return last;
+	}
+
+
+	/** Number of samples which had to be repeated, as the next block was late, since the last call to resetStatistics().
+	@return number of samples
+	*/
+	inline
+	uint32_t getUnderruns()
+	{
+		return underruns;
+	}
+
+
+	/** The smallest number of samples which were left to play, when a block arrived, since the last call to resetStatistics().
+	If this is close to 0, update() should be called more often, or BUFFER_SIZE made larger. 0, if blocks were late.
+	@return number of samples, or 0xFFFF if no block has arrived, yet
+	*/
+	inline
+	uint16_t getPrefetchMargin()
+	{
+		return min_margin;
+	}
+
+
+	/** Resets the counters of getUnderruns() and getPrefetchMargin().
+	*/
+	inline
+	void resetStatistics()
+	{
+		underruns = 0;
+		min_margin = 0xFFFF;
+	}
+
+
+private:
+	// Read the next block into the free half of the buffer, wrapping around to the start position at the end, if looping
+	void fetch()
+	{
+		const uint8_t target = fetch_target;
+		bool done = false;
+		uint16_t length = source.read(fetch_position, (uint8_t *) buffers[target], BUFFER_SIZE);
+		fetch_position += length;
+		if (length < BUFFER_SIZE) {
+			if (looping) {
+				// fill up the block from the start position, so no short block has to be played in a hurry
+				fetch_position = start_position;
+				const uint16_t more = source.read(fetch_position, (uint8_t *) buffers[target] + length, BUFFER_SIZE - length);
+				fetch_position += more;
+				length += more;
+				done = !more;  // nothing to play from the start position, either
+			} else {
+				done = true;
+			}
+		}
+		if (length) {
+			lengths[target] = length;
+			store(filled[target], true);  // only after the block (and its length) is in place, for next()
+			fetch_target ^= 1;
+		}
+		if (done) store(source_done, true);  // only after the last block, so next() does not take it for the end, while it is still due
+	}
+
+#if IS_AVR()
+	// No second core, or render task, on AVR: next() and update() both run from loop(), and single bytes are written atomically
+	template <typename T> using Shared = volatile T;
+	template <typename T> static T load(const volatile T &value) { return value; }
+	template <typename T> static void store(volatile T &value, T v) { value = v; }
+#else
+	template <typename T> using Shared = std::atomic<T>;
+	template <typename T> static T load(const std::atomic<T> &value) { return value.load(std::memory_order_acquire); }
+	template <typename T> static void store(std::atomic<T> &value, T v) { value.store(v, std::memory_order_release); }
+#endif
+
+	SOURCE & source;
+	int8_t buffers[2][BUFFER_SIZE];
+	uint16_t lengths[2];
+	Shared<bool> filled[2];   // the half holds samples yet to be played: set by update(), cleared by next()
+	uint8_t playing;          // the half being played, by next()
+	Shared<uint16_t> readpos; // position in the playing half, written by next(), read by update() for getPrefetchMargin()
+	int8_t last;
+	uint8_t fetch_target;     // the half to be filled next, by update()
+	uint32_t fetch_position, start_position;
+	Shared<bool> source_done;
+	bool looping;
+	uint32_t underruns;
+	uint16_t min_margin;
+};
+
+
+/** A block source for StreamingSample, reading from an array in flash (see CONSTTABLE_STORAGE) or RAM, e.g. for testing.
+*/
+class MemoryBlockSource
+{
+public:
+	/** Constructor.
+	@param data the sample, signed 8 bit
+	@param size the number of samples
+	*/
+	MemoryBlockSource(const int8_t * data, uint32_t size) : data(data), size(size)
+	{}
+
+	/** Copies up to length bytes from position to buffer. See StreamingSample. */
+	uint16_t read(uint32_t position, uint8_t * buffer, uint16_t length)
+	{
+		if (position >= size) return 0;
+		if (length > size - position) length = size - position;
+		for (uint16_t i = 0; i < length; ++i) buffer[i] = FLASH_OR_RAM_READ<const int8_t>(data + position + i);
+		return length;
+	}
+
+private:
+	const int8_t * data;
+	uint32_t size;
+};
+
+
+#if IS_HOST() || defined(FOR_DOXYGEN_ONLY)
+/** A block source for StreamingSample, reading from a file, on the host only (see @ref hardware_host).
+*/
+class FileBlockSource
+{
+public:
+	/** Constructor.
+	@param filename file with raw signed 8 bit samples. If it can not be opened, the sample is empty.
+	*/
+	FileBlockSource(const char * filename) : file(fopen(filename, "rb"))
+	{}
+
+	~FileBlockSource()
+	{
+		if (file) fclose(file);
+	}
+
+	/** Copies up to length bytes from position to buffer. See StreamingSample. */
+	uint16_t read(uint32_t position, uint8_t * buffer, uint16_t length)
+	{
+		if (!file || fseek(file, position, SEEK_SET)) return 0;
+		return fread(buffer, 1, length, file);
+	}
+
+private:
+	FILE * file;
+};
+#endif
+
+/**
+@example 08.Samples/StreamingSample/StreamingSample.ino
+This is an example of StreamingSample, playing a sample through a double buffer, as from external storage.
+*/
+
+#endif /* STREAMINGSAMPLE_H_ */
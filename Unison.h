@@ -0,0 +1,262 @@
+/*
+ * Unison.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef UNISON_H_
+#define UNISON_H_
+
+#include "Arduino.h"
+#include "Oscil.h"
+
+/**
+Unison plays the same wavetable with several slightly detuned voices at once, for thick "supersaw" type sounds (typically with a
+sawtooth table and 5 to 9 voices), or chorused pads. It is much cheaper than the equivalent stack of Oscils:
+- all detuned phase increments are derived from one base increment and a spread value, with one multiplication, followed by one
+  addition per voice, so changing the pitch or detuning (e.g. for glides or vibrato at control rate) is cheap,
+- all phases are kept in one array, and all voices are summed in one tight loop, sharing one table.
+
+Voices are detuned symmetrically around the base frequency, in equal steps set by setDetune(). The level of the outer voices
+relative to the centre voice(s) can be set with setMix(). For stereo, nextStereo() spreads the voices alternately to the left and
+right, such that each side gets a balanced mix of lower and higher detuned voices.
+
+@tparam NUM_VOICES number of voices, 1 to 16. 7 is a classic choice for a supersaw.
+@tparam NUM_TABLE_CELLS size of the wavetable, as for Oscil. Must be a power of two.
+@tparam UPDATE_RATE MOZZI_AUDIO_RATE, typically.
+
+@code
+Unison<7, SAW2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSuperSaw(SAW2048_DATA);
+
+void setup() {
+  aSuperSaw.setMidiNote(45 << 8);
+  aSuperSaw.setDetune(40);
+  startMozzi();
+}
+
+AudioOutput updateAudio() {
+  return MonoOutput::fromNBit(11, aSuperSaw.next());
+}
+@endcode
+*/
+template <uint8_t NUM_VOICES, uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
+class Unison
+{
+	static_assert((NUM_VOICES > 0) && (NUM_VOICES <= 16), "Unison must have between 1 and 16 voices");
+	static_assert((NUM_TABLE_CELLS & (NUM_TABLE_CELLS - 1)) == 0, "NUM_TABLE_CELLS must be a power of two");
+
+public:
+	/** Constructor.
+	@param TABLE_NAME the wavetable played by all voices.
+	*/
+	Unison(const int8_t * TABLE_NAME = nullptr) : table(TABLE_NAME), base_increment(0), detune(0), side_level(255)
+	{
+		// start the voices at unrelated phases, to avoid a loud, phasey attack
+		uint32_t phase = 0;
+		for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+			phases[i] = phase;
+			phase += 0x9E3779B9UL;
+		}
+		updateIncrements();
+	}
+
+
+	/** Change the wavetable played by all voices.
+	@param TABLE_NAME is the name of the array in the table ".h" file you're using.
+	*/
+	void setTable(const int8_t * TABLE_NAME)
+	{
+		table = TABLE_NAME;
+	}
+
+
+	/** Set the base frequency.
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(float frequency)
+	{
+		setPhaseInc((uint32_t)((((float)NUM_TABLE_CELLS * frequency)/UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER));
+	}
+
+
+	/** Set the base frequency in Q16n16 fixed-point format. See Oscil::setFreq_Q16n16() for the limitations.
+	@param frequency in Q16n16 fixed-point format
+	*/
+	inline
+	void setFreq_Q16n16(Q16n16 frequency)
+	{
+		if (NUM_TABLE_CELLS >= UPDATE_RATE) {
+			setPhaseInc(((uint32_t)frequency) * (NUM_TABLE_CELLS/UPDATE_RATE));
+		} else {
+			setPhaseInc(((uint32_t)frequency) / (UPDATE_RATE/NUM_TABLE_CELLS));
+		}
+	}
+
+
+	/** Set the base frequency from a (fractional) MIDI note number. See Oscil::setMidiNote().
+	@param note MIDI note number in Q8n8 fixed-point format, from 0 to 127.996 (higher values are treated as note 128)
+	*/
+	inline
+	void setMidiNote(Q8n8 note)
+	{
+		setPhaseInc(MozziPrivate::OscilMidiIncrements<NUM_TABLE_CELLS, UPDATE_RATE>::increment(note));
+	}
+
+
+	/** Set the phase increment of the base frequency directly, see Oscil::phaseIncFromFreq().
+	@param phaseinc_fractional the phase increment
+	*/
+	inline
+	void setPhaseInc(uint32_t phaseinc_fractional)
+	{
+		base_increment = phaseinc_fractional;
+		updateIncrements();
+	}
+
+
+	/** Set the amount of detuning.
+	@param spread the frequency difference between neighbouring voices, in units of 1/4096 of the base frequency. E.g. 24 is about
+	10 cents between neighbouring voices. The outer voices are detuned by (NUM_VOICES-1)/2 times that in either direction.
+	*/
+	inline
+	void setDetune(uint8_t spread)
+	{
+		detune = spread;
+		updateIncrements();
+	}
+
+
+	/** Set the level of the detuned voices, relative to the centre voice (or the two centre voices, for an even number of voices).
+	@param level 0 (centre voice(s) only) to 255 (all voices equally loud, the default)
+	*/
+	inline
+	void setMix(uint8_t level)
+	{
+		side_level = level;
+	}
+
+
+	/** Advances all voices by one sample, and returns their sum.
+	@return the sum of all voices, up to +-128 * NUM_VOICES.
+	*/
+	inline
+	int16_t next()
+	{
+		MOZZI_PROFILE_SCOPE("Unison::next");
+		int16_t centre = 0, sides = 0;
+		for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+			const int8_t sample = advance(i);
+			if (isCentre(i)) centre += sample;
+			else sides += sample;
+		}
+		return centre + (((int32_t) sides * side_level) >> 8);
+	}
+
+
+	/** Advances all voices by one sample, and returns their sum, spread to two channels. The centre voice (if NUM_VOICES is odd)
+	goes to both channels, at half level, the others alternately to the left and the right.
+	@param left the sum of the left voices, up to about +-64 * NUM_VOICES
+	@param right the sum of the right voices
+	*/
+	inline
+	void nextStereo(int16_t & left, int16_t & right)
+	{
+		MOZZI_PROFILE_SCOPE("Unison::nextStereo");
+		int16_t both = 0, centre_left = 0, centre_right = 0, sides_left = 0, sides_right = 0;
+		for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+			const int8_t sample = advance(i);
+			if ((NUM_VOICES & 1) && (i == NUM_VOICES / 2)) both += sample;
+			else if (isCentre(i)) (isRight(i) ? centre_right : centre_left) += sample;
+			else (isRight(i) ? sides_right : sides_left) += sample;
+		}
+		left = (both >> 1) + centre_left + (((int32_t) sides_left * side_level) >> 8);
+		right = (both >> 1) + centre_right + (((int32_t) sides_right * side_level) >> 8);
+	}
+
+
+	/** Render a block of samples, with the same result as calling next() n times, but faster. Use this in updateAudioBlock()
+	(see @ref MOZZI_AUDIO_BLOCK_SIZE).
+	@param dst where to write the samples
+	@param n number of samples to write
+	*/
+	void fill(int16_t * dst, uint16_t n)
+	{
+		MOZZI_PROFILE_SCOPE("Unison::fill");
+		const int8_t * const tab = table;
+		int16_t centre[FILL_CHUNK], sides[FILL_CHUNK];
+		while (n) {
+			const uint16_t chunk = (n < FILL_CHUNK) ? n : FILL_CHUNK;
+			for (uint16_t j = 0; j < chunk; ++j) centre[j] = sides[j] = 0;
+			// one voice at a time, so its phase and increment stay in registers
+			for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+				int16_t * const sums = isCentre(i) ? centre : sides;
+				uint32_t phase = phases[i];
+				const uint32_t increment = increments[i];
+				for (uint16_t j = 0; j < chunk; ++j) {
+					phase += increment;
+					sums[j] += FLASH_OR_RAM_READ<const int8_t>(tab + ((phase >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
+				}
+				phases[i] = phase;
+			}
+			for (uint16_t j = 0; j < chunk; ++j) dst[j] = centre[j] + (((int32_t) sides[j] * side_level) >> 8);
+			dst += chunk;
+			n -= chunk;
+		}
+	}
+
+
+private:
+	static const uint16_t FILL_CHUNK = 32;
+
+	/* Voices in the middle, which are not detuned (odd number of voices), or least detuned (even number) */
+	static inline
+	bool isCentre(uint8_t i)
+	{
+		return (NUM_VOICES & 1) ? (i == NUM_VOICES / 2) : ((i == NUM_VOICES / 2) || (i == NUM_VOICES / 2 - 1));
+	}
+
+	/* Alternate left and right from the outside in, mirrored, so each side has as many voices tuned up as tuned down */
+	static inline
+	bool isRight(uint8_t i)
+	{
+		return (i < NUM_VOICES / 2) ? (i & 1) : !((NUM_VOICES - 1 - i) & 1);
+	}
+
+	inline
+	int8_t advance(uint8_t i)
+	{
+		phases[i] += increments[i];
+		return FLASH_OR_RAM_READ<const int8_t>(table + ((phases[i] >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
+	}
+
+	/* One multiplication for the step, then one addition per voice */
+	void updateIncrements()
+	{
+		const uint32_t step = (base_increment >> 12) * detune;
+		uint32_t increment = base_increment - ((step * (NUM_VOICES - 1)) >> 1);
+		for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+			increments[i] = increment;
+			increment += step;
+		}
+	}
+
+	uint32_t phases[NUM_VOICES];
+	uint32_t increments[NUM_VOICES];
+	const int8_t * table;
+	uint32_t base_increment;
+	uint8_t detune;
+	uint8_t side_level;
+};
+
+/**
+@example 06.Synthesis/SuperSaw/SuperSaw.ino
+This is an example of a detuned "supersaw" with Unison.
+*/
+
+#endif /* UNISON_H_ */
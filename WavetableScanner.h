@@ -0,0 +1,273 @@
+/*
+ * WavetableScanner.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef WAVETABLESCANNER_H_
+#define WAVETABLESCANNER_H_
+
+#include "Arduino.h"
+#include "Oscil.h"
+
+/**
+WavetableScanner plays a "wavetable" in the sense of wavetable synthesizers: an ordered set of single cycle waveforms (frames) of the
+same size, e.g. a sine slowly turning into a sawtooth. Any position between the frames can be played, by mixing the two adjacent
+frames, so the timbre can be swept (scanned) smoothly with setMorph(), e.g. from an envelope or an LFO. Unlike switching tables
+in an Oscil (or MetaOscil), this does not produce clicks or audible steps.
+
+Both frames are read at the same index, so there is only one phase accumulator, and one index calculation per sample. The frames can
+be given either as one contiguous array (NUM_FRAMES * NUM_TABLE_CELLS samples, frame after frame, as most wavetable formats are
+stored), or as an array of pointers to separate tables of the same size (e.g. the ones in Mozzi's tables folder).
+
+@tparam NUM_TABLE_CELLS size of each frame. Must be a power of two.
+@tparam UPDATE_RATE MOZZI_AUDIO_RATE, typically.
+
+@code
+const int8_t * const tables[] = {SIN2048_DATA, TRIANGLE2048_DATA, SAW2048_DATA};
+WavetableScanner<2048, MOZZI_AUDIO_RATE> aScanner(tables, 3);
+
+void updateControl() {
+  aScanner.setMorph(mozziAnalogRead<9>(A0));  // 0 to 511, i.e. from the first frame to (almost) the third
+}
+@endcode
+*/
+template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
+class WavetableScanner
+{
+	static_assert((NUM_TABLE_CELLS & (NUM_TABLE_CELLS - 1)) == 0, "NUM_TABLE_CELLS must be a power of two");
+
+public:
+	/** Constructor, for frames stored in one contiguous array.
+	@param frames the first sample of the first frame. Frame n starts at frames + n * NUM_TABLE_CELLS.
+	@param num_frames the number of frames, at least 1.
+	*/
+	WavetableScanner(const int8_t * frames, uint8_t num_frames) : phase_fractional(0), phase_increment_fractional(0)
+	{
+		setFrames(frames, num_frames);
+	}
+
+
+	/** Constructor, for frames stored in separate tables.
+	@param tables an array of pointers to the frames, in order. Only the pointer to the array is stored, so the array must stay valid.
+	@param num_tables the number of frames, at least 1.
+	*/
+	WavetableScanner(const int8_t * const * tables, uint8_t num_tables) : phase_fractional(0), phase_increment_fractional(0)
+	{
+		setTables(tables, num_tables);
+	}
+
+
+	/** Constructor, without frames. Set them with setFrames() or setTables(), before playing.
+	*/
+	WavetableScanner() : phase_fractional(0), phase_increment_fractional(0), frames(nullptr), tables(nullptr), num_frames(0)
+	{}
+
+
+	/** Set the frames, stored in one contiguous array. The morph position is reset to the first frame.
+	@param frames the first sample of the first frame. Frame n starts at frames + n * NUM_TABLE_CELLS.
+	@param num_frames the number of frames, at least 1.
+	*/
+	void setFrames(const int8_t * frames, uint8_t num_frames)
+	{
+		this->frames = frames;
+		tables = nullptr;
+		this->num_frames = num_frames;
+		setMorph(0);
+	}
+
+
+	/** Set the frames, stored in separate tables. The morph position is reset to the first frame.
+	@param tables an array of pointers to the frames, in order. Only the pointer to the array is stored, so the array must stay valid.
+	@param num_tables the number of frames, at least 1.
+	*/
+	void setTables(const int8_t * const * tables, uint8_t num_tables)
+	{
+		frames = nullptr;
+		this->tables = tables;
+		num_frames = num_tables;
+		setMorph(0);
+	}
+
+
+	/** Set the position in the wavetable.
+	@param position in Q8n8 fixed-point format: the integer part is the frame, the fractional part the amount of the next frame mixed
+	in. E.g. 0 plays the first frame, 384 (1.5 * 256) an even mix of the second and third frame. Positions beyond the last
+	frame play the last frame.
+	*/
+	inline
+	void setMorph(Q8n8 position)
+	{
+		uint8_t frame = position >> 8;
+		fraction = position;
+		if (frame >= num_frames - 1) {
+			frame = num_frames - 1;
+			fraction = 0;
+		}
+		frame_a = frameAt(frame);
+		frame_b = fraction ? frameAt(frame + 1) : frame_a;
+	}
+
+
+	/** Set the position in the wavetable, in UFix<NI,NF> fixed-point format, see setMorph(Q8n8). Fractional bits beyond 8 are ignored.
+	@param position frame number, with fraction
+	*/
+	template <int8_t NI, int8_t NF, uint64_t RANGE>
+	inline
+	void setMorph(UFix<NI,NF,RANGE> position)
+	{
+		setMorph((Q8n8) UFix<8,8>(position).asRaw());
+	}
+
+
+	/** Updates the phase according to the current frequency and returns the sample at the new phase position, mixed from the two
+	frames adjacent to the morph position.
+	@return the next sample.
+	*/
+	inline
+	int8_t next()
+	{
+		MOZZI_PROFILE_SCOPE("WavetableScanner::next");
+		phase_fractional += phase_increment_fractional;
+		return mix((phase_fractional >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1));
+	}
+
+
+	/** Fill a block of samples, with the same result as calling next() n times. See @ref MOZZI_AUDIO_BLOCK_SIZE.
+	@param dst where to write the samples
+	@param n number of samples to write
+	*/
+	void fill(int8_t * dst, uint16_t n)
+	{
+		MOZZI_PROFILE_SCOPE("WavetableScanner::fill");
+		uint32_t phase = phase_fractional;
+		const uint32_t increment = phase_increment_fractional;
+		while (n--) {
+			phase += increment;
+			*dst++ = mix((phase >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1));
+		}
+		phase_fractional = phase;
+	}
+
+
+	/** Set the frequency with an unsigned int. See Oscil::setFreq(int) for the limitations.
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(int frequency)
+	{
+		phase_increment_fractional = ((uint32_t)frequency) * ((OSCIL_F_BITS_AS_MULTIPLIER*NUM_TABLE_CELLS)/UPDATE_RATE);
+	}
+
+
+	/** Set the frequency with a float.
+	@param frequency in Hz
+	*/
+	inline
+	void setFreq(float frequency)
+	{
+		phase_increment_fractional = (uint32_t)((((float)NUM_TABLE_CELLS * frequency)/UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER);
+	}
+
+
+	/** Set the frequency in Q16n16 fixed-point format. See Oscil::setFreq_Q16n16() for the limitations.
+	@param frequency in Q16n16 fixed-point format
+	*/
+	inline
+	void setFreq_Q16n16(Q16n16 frequency)
+	{
+		if (NUM_TABLE_CELLS >= UPDATE_RATE) {
+			phase_increment_fractional = ((uint32_t)frequency) * (NUM_TABLE_CELLS/UPDATE_RATE);
+		} else {
+			phase_increment_fractional = ((uint32_t)frequency) / (UPDATE_RATE/NUM_TABLE_CELLS);
+		}
+	}
+
+
+	/** Set the frequency from a (fractional) MIDI note number. See Oscil::setMidiNote().
+	@param note MIDI note number in Q8n8 fixed-point format, from 0 to 127.996 (higher values are treated as note 128)
+	*/
+	inline
+	void setMidiNote(Q8n8 note)
+	{
+		phase_increment_fractional = MozziPrivate::OscilMidiIncrements<NUM_TABLE_CELLS, UPDATE_RATE>::increment(note);
+	}
+
+
+	/** Set a specific phase increment. See Oscil::phaseIncFromFreq().
+	@param phaseinc_fractional the phase increment
+	*/
+	inline
+	void setPhaseInc(uint32_t phaseinc_fractional)
+	{
+		phase_increment_fractional = phaseinc_fractional;
+	}
+
+
+	/** Set the phase.
+	@param phase a position in the frame.
+	*/
+	inline
+	void setPhase(unsigned int phase)
+	{
+		phase_fractional = (uint32_t)phase << OSCIL_F_BITS;
+	}
+
+
+	/** Set the phase, in the same format as Oscil::setPhaseFractional().
+	@param phase a position in the frame, shifted left by OSCIL_F_BITS.
+	*/
+	inline
+	void setPhaseFractional(uint32_t phase)
+	{
+		phase_fractional = phase;
+	}
+
+
+	/** Get the phase, in the same format as Oscil::getPhaseFractional().
+	@return position in the frame, shifted left by OSCIL_F_BITS.
+	*/
+	inline
+	uint32_t getPhaseFractional()
+	{
+		return phase_fractional;
+	}
+
+
+private:
+	inline
+	const int8_t * frameAt(uint8_t frame)
+	{
+		return frames ? (frames + (uint32_t) frame * NUM_TABLE_CELLS) : tables[frame];
+	}
+
+	/* The sample at index, from both frames, mixed according to the fraction of the morph position */
+	inline
+	int8_t mix(uint16_t index)
+	{
+		const int8_t a = FLASH_OR_RAM_READ<const int8_t>(frame_a + index);
+		const int8_t b = FLASH_OR_RAM_READ<const int8_t>(frame_b + index);
+		return a + (int8_t) (((int32_t) (b - a) * fraction) >> 8);  // the product can exceed 16 bits
+	}
+
+	uint32_t phase_fractional;
+	uint32_t phase_increment_fractional;
+	const int8_t * frames;
+	const int8_t * const * tables;
+	const int8_t * frame_a;
+	const int8_t * frame_b;
+	uint8_t num_frames;
+	uint8_t fraction;
+};
+
+/**
+@example 06.Synthesis/Wavetable_Scan/Wavetable_Scan.ino
+This is an example of WavetableScanner, sweeping through a set of waveforms.
+*/
+
+#endif /* WAVETABLESCANNER_H_ */
@@ -84,6 +84,7 @@
  *   - MOZZI_OUTPUT_PDM_VIA_SERIAL Output pulse density modulated (PDM) samples via a hardware serial interface.
  *   - MOZZI_OUTPUT_I2S_DAC Output samples to a PT8211 (or compatible) DAC connected to a hardware I2S interface.
  *   - MOZZI_OUTPUT_INTERNAL_DAC Output to the interal DAC on boards that support one.
+ *   - MOZZI_OUTPUT_FILE Write samples to a file (or stdout) as fast as possible, instead of in real time. Only available on the @ref hardware_host build.
  *
  * TODO: Adding an R2R-DAC option would be cool,  http://blog.makezine.com/2008/05/29/makeit-protodac-shield-fo/ , some discussion on Mozzi-users.
 */
@@ -148,6 +149,124 @@
 #define MOZZI_CONTROL_RATE FOR_DOXYGEN_ONLY
 
 
+/** @ingroup config
+ * @def MOZZI_AUDIO_BLOCK_SIZE
+ *
+ * @brief Render audio in blocks of samples, rather than one sample at a time.
+ *
+ * By default (value 1), audioHook() calls updateAudio() once for each sample. When this is set to a power of two larger than 1, audioHook() instead
+ * calls updateAudioBlock() (which your sketch must provide instead of updateAudio()) to render up to MOZZI_AUDIO_BLOCK_SIZE samples in one go, directly
+ * into Mozzi's output buffer. This saves the per-sample call overhead, and allows the compiler to unroll and vectorize the inner loops of your code.
+ *
+ * A block is rendered once at least MOZZI_AUDIO_BLOCK_SIZE samples are free in the output buffer. Blocks never cross a control rate boundary, i.e.
+ * updateControl() is still called at exactly the same sample positions as in per-sample mode. Thus blocks may be shorter than MOZZI_AUDIO_BLOCK_SIZE,
+ * and your updateAudioBlock() must handle any number of samples between 1 and MOZZI_AUDIO_BLOCK_SIZE.
+ *
+ * Larger blocks reduce overhead, but add latency (up to MOZZI_AUDIO_BLOCK_SIZE samples), and make each call to audioHook() take longer. Values
+ * of 16 to 64 are a reasonable starting point. Block rendering cannot currently be combined with @ref MOZZI_AUDIO_INPUT .
+*/
+#define MOZZI_AUDIO_BLOCK_SIZE FOR_DOXYGEN_ONLY
+
+
+/** @ingroup config
+ * @def MOZZI_OUTPUT_BUFFER_SIZE
+ *
+ * @brief Number of samples in Mozzi's audio output buffer. Must be a power of two between 2 and 32768, default is 256.
+ *
+ * The output buffer decouples the (interrupt driven) output of samples from the rendering in audioHook(). A deeper buffer
+ * can bridge longer interruptions of loop() (e.g. by WiFi or SD card access), at the cost of RAM (MOZZI_OUTPUT_BUFFER_SIZE * sizeof(AudioOutput)),
+ * and latency: Controls take effect up to MOZZI_OUTPUT_BUFFER_SIZE / MOZZI_AUDIO_RATE seconds after they were set in updateControl().
+ * At the default values, this is 256 samples, or 15.6 milliseconds at 16384 Hz. A buffer of 32 samples brings this down to about 2 milliseconds, for
+ * snappier response to MIDI input, but leaves little headroom for anything taking longer in loop().
+ *
+ * audioTicks() and mozziMicros() are derived from the read position in the output buffer, and lag behind the rendering position by
+ * up to the same amount.
+ *
+ * If you use @ref MOZZI_AUDIO_BLOCK_SIZE, the buffer must be at least as large as one block, and should better be several times larger.
+ *
+ * @note Some output modes do not use this buffer, at all, but rely on buffering by the platform (e.g. I2S and PWM modes on the RP2040 and the ESP32).
+ *       The option has no effect for those.
+ * @note On AVR, the maximum is 256, so the buffer positions can be updated atomically (and RAM is tight, anyway).
+*/
+#define MOZZI_OUTPUT_BUFFER_SIZE FOR_DOXYGEN_ONLY
+
+
+/** @ingroup config
+ * @def MOZZI_CONTROL_TASKS
+ *
+ * @brief Maximum number of additional control tasks, running at rates of their own. Default is 0 (feature disabled).
+ *
+ * updateControl() is called at a single rate, MOZZI_CONTROL_RATE. When different parts of a sketch need updating at different rates (e.g. envelopes at 1 kHz,
+ * LFOs at 256 Hz, and sensors at 32 Hz), set this to the number of additional rates needed, and register a function for each with addControlTask().
+ * This is both more convenient, and more efficient than counting calls inside updateControl(): Mozzi will arrange for the tasks to run in different
+ * samples, as far as possible, so the worst case time spent on control code for any one sample stays low.
+ *
+ * Each slot costs a few bytes of RAM. Checking for due tasks costs a little CPU time in every sample, even for tasks not added.
+*/
+#define MOZZI_CONTROL_TASKS FOR_DOXYGEN_ONLY
+
+
+/** @ingroup config
+ * @def MOZZI_EVENT_QUEUE_SIZE
+ *
+ * @brief Maximum number of pending sample accurate events. Default is 0 (feature disabled).
+ *
+ * Changes made in updateControl() take effect at the next control tick, i.e. up to 1/MOZZI_CONTROL_RATE seconds late. That is fine for knobs, but
+ * audibly sloppy for drum patterns, or syncing to MIDI clock. With this option set to a value larger than 0, events can be queued with scheduleEvent(),
+ * and will be passed to handleAudioEvent() right before the exact sample they were scheduled for.
+ *
+ * The queue has a fixed capacity, and does not allocate memory. Each slot takes 8 bytes of RAM. Scheduling an event costs time proportional
+ * to the number of events pending, handling it is cheap.
+*/
+#define MOZZI_EVENT_QUEUE_SIZE FOR_DOXYGEN_ONLY
+
+
+/** @ingroup config
+ * @def MOZZI_LOAD_METER
+ *
+ * @brief Measure how much of the available CPU time is spent rendering audio, and whether the output buffer ever ran empty.
+ *
+ * When enabled, Mozzi keeps track of the time spent in updateAudio() (or updateAudioBlock()) and updateControl(), and of the fill level of
+ * the output buffer. See mozziCpuLoad(), mozziAverageCycles(), mozziPeakCycles(), mozziUnderruns(), and mozziBufferLowWater(). This is
+ * meant for finding out how many voices, filters, etc. a given board can handle, and to catch glitches in the field.
+ *
+ * Time is measured using the CPU's cycle counter, where available (ARM Cortex-M3 and above, ESP32, ESP8266). Elsewhere (e.g. AVR), micros() is
+ * used, which is coarse, and adds some overhead of its own (on AVR, reading micros() twice per sample costs about 10% of the time available
+ * per sample at 16384 Hz).
+ *
+ * Currently allowed values are:
+ *   - MOZZI_LOAD_METER_NONE
+ *     Disabled (default). No overhead.
+ *   - MOZZI_LOAD_METER_ENABLED
+ *     Measurements enabled.
+*/
+#define MOZZI_LOAD_METER FOR_DOXYGEN_ONLY
+
+
+/** @ingroup config
+ * @def MOZZI_PROFILER
+ *
+ * @brief Count calls and CPU cycles of individual units of code.
+ *
+ * When enabled, each scope marked with MOZZI_PROFILE_SCOPE("name") (see mozzi_profile.h) counts the number of times it is entered, and the CPU cycles
+ * spent inside. mozziProfileReport() prints the results. The most expensive units of Mozzi itself are instrumented, already: Oscil::next(),
+ * ResonantFilter::next(), StateVariable::next(), AudioDelayFeedback::next(), SampleHuffman::decode(), ReverbTank::next(). You can add
+ * your own scopes, e.g. in updateAudio().
+ *
+ * Up to MOZZI_PROFILE_MAX_SCOPES (default: 16) differently named scopes are recorded, any further ones are ignored.
+ *
+ * The same cycle counters are used as for @ref MOZZI_LOAD_METER . Measuring adds some overhead of its own, which is not negligible for very short scopes
+ * such as Oscil::next(). Use the numbers for comparison, rather than as absolute truth.
+ *
+ * Currently allowed values are:
+ *   - MOZZI_PROFILER_NONE
+ *     Disabled (default). MOZZI_PROFILE_SCOPE() compiles to nothing.
+ *   - MOZZI_PROFILER_ENABLED
+ *     Profiling enabled.
+*/
+#define MOZZI_PROFILER FOR_DOXYGEN_ONLY
+
+
 /** @ingroup config
  * @def MOZZI_ANALOG_READ
  *
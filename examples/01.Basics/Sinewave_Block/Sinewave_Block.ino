@@ -0,0 +1,58 @@
+/*  Example playing a sinewave with vibrato, rendering audio in blocks
+    of samples rather than one sample at a time,
+    using Mozzi sonification library.
+
+    Demonstrates the use of MOZZI_AUDIO_BLOCK_SIZE and updateAudioBlock().
+    Rather than calling updateAudio() once per sample, Mozzi calls
+    updateAudioBlock() to fill several samples in one go. This saves
+    some overhead per sample, which is most noticeable with many
+    oscillators, and on faster boards.
+
+    updateControl() is still called at exactly the same points in time
+    as with updateAudio(), so blocks may sometimes be shorter than
+    MOZZI_AUDIO_BLOCK_SIZE.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_AUDIO_BLOCK_SIZE 32  // render up to 32 samples per call
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <tables/sin2048_int8.h>
+
+Oscil <SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSin(SIN2048_DATA);
+Oscil <SIN2048_NUM_CELLS, MOZZI_CONTROL_RATE> kVibrato(SIN2048_DATA);
+
+void setup(){
+  startMozzi();
+  kVibrato.setFreq(3.f);
+}
+
+
+void updateControl(){
+  aSin.setFreq(440 + (kVibrato.next() >> 3));
+}
+
+
+void updateAudioBlock(AudioOutput* out, uint16_t n){
+  for (uint16_t i = 0; i < n; ++i) {
+    out[i] = MonoOutput::from8Bit(aSin.next());
+  }
+}
+
+
+void loop(){
+  audioHook();
+}
@@ -3,6 +3,10 @@
 
    Demonstrates the audible quality of different length tables
    played with Oscil and scheduling with EventDelay.
+   The last one is the smallest table again, but with linear
+   interpolation (INTERP_LINEAR), which sounds as clean as the largest,
+   followed by the smallest table with phase dithering, which turns the
+   spurious tones into a soft hiss.
 
    Circuit: Audio output on digital pin 9 on a Uno or similar, or
    DAC/A14 on Teensy 3.1, or
@@ -38,10 +42,12 @@ Oscil <SIN1024_NUM_CELLS, MOZZI_AUDIO_RATE> aSin2(SIN1024_DATA); // borderline,
 Oscil <SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSin3(SIN2048_DATA); // no audible improvement from here on
 Oscil <SIN4096_NUM_CELLS, MOZZI_AUDIO_RATE> aSin4(SIN4096_DATA); // for 45 year old loud sound damaged ears
 Oscil <SIN8192_NUM_CELLS, MOZZI_AUDIO_RATE> aSin5(SIN8192_DATA);
+Oscil <SIN256_NUM_CELLS, MOZZI_AUDIO_RATE, int8_t, INTERP_LINEAR> aSin6(SIN256_DATA); // 32 times smaller than 8192, interpolated
+Oscil <SIN256_NUM_CELLS, MOZZI_AUDIO_RATE, int8_t, INTERP_NONE, true> aSin7(SIN256_DATA); // dithered phase
 
 EventDelay kWhoseTurnDelay;
 
-const byte NUM_OSCILS = 6;
+const byte NUM_OSCILS = 8;
 byte whose_turn = 0; // which oscil to listen to
 
 // Line to sweep frequency at control rate
@@ -86,6 +92,12 @@ void updateControl(){
   case 5:
     aSin5.setFreq(f);
     break;
+  case 6:
+    aSin6.setFreq(f);
+    break;
+  case 7:
+    aSin7.setFreq(f);
+    break;
   }
 }
 
@@ -111,6 +123,12 @@ AudioOutput updateAudio(){
   case 5:
     asig = aSin5.next();
     break;
+  case 6:
+    asig = aSin6.next();
+    break;
+  case 7:
+    asig = aSin7.next();
+    break;
   }
   return MonoOutput::from8Bit(asig);
 }
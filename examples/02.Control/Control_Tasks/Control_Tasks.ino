@@ -0,0 +1,79 @@
+/*  Example of running different parts of the control code at different rates,
+    using Mozzi sonification library.
+
+    Demonstrates MOZZI_CONTROL_TASKS and addControlTask().
+    A sine wave is given a fast decaying envelope (updated at 1024 Hz, for
+    crisp attacks), a slow vibrato (updated at 256 Hz), and a knob for
+    the pitch (read at 32 Hz). updateControl() triggers a new note every
+    half second. Mozzi takes care of calling each function at its own rate,
+    and of spreading them out, so they do not all run in the same sample.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+    Potentiometer on A0.
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_CONTROL_TASKS 3  // number of tasks to add, below
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <tables/sin2048_int8.h>
+
+#define ENVELOPE_RATE 1024
+#define VIBRATO_RATE 256
+#define KNOB_RATE 32
+
+Oscil <SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSin(SIN2048_DATA);
+Oscil <SIN2048_NUM_CELLS, VIBRATO_RATE> kVibrato(SIN2048_DATA);
+
+uint16_t gain = 0;   // 8.8 fixed point
+uint16_t base_freq = 220;
+
+void updateEnvelope(){
+  gain -= gain >> 7;
+}
+
+void updateVibrato(){
+  aSin.setFreq((int) (base_freq + (kVibrato.next() >> 5)));
+}
+
+void readKnob(){
+  base_freq = 110 + (mozziAnalogRead<10>(A0) >> 1);
+}
+
+void setup(){
+  kVibrato.setFreq(5);
+  addControlTask(updateEnvelope, MOZZI_AUDIO_RATE / ENVELOPE_RATE);
+  addControlTask(updateVibrato, MOZZI_AUDIO_RATE / VIBRATO_RATE);
+  addControlTask(readKnob, MOZZI_AUDIO_RATE / KNOB_RATE);
+  startMozzi();
+}
+
+
+void updateControl(){
+  static uint8_t count = 0;
+  if (++count >= MOZZI_CONTROL_RATE / 2) {  // new note every half second
+    count = 0;
+    gain = 65535;
+  }
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::from16Bit(aSin.next() * (gain >> 8));
+}
+
+
+void loop(){
+  audioHook();
+}
@@ -0,0 +1,73 @@
+/*  Example of setting the pitch of many oscillators by MIDI note number,
+    with vibrato and pitch bend, using Mozzi sonification library.
+
+    Demonstrates Oscil::setMidiNote(), which sets the frequency from
+    a fractional (Q8n8) MIDI note number, using a phase increment table
+    calculated at compile time. This is much cheaper than converting
+    with Q16n16_mtof() and setting the frequency with setFreq_Q16n16(),
+    so all 8 voices of a chord can be updated at every control step.
+
+    A slow LFO bends the whole chord up and down by a whole tone,
+    and each voice has its own vibrato.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <tables/sin256_int8.h>
+#include <tables/triangle_warm8192_int8.h>
+
+#define NUM_VOICES 8
+
+Oscil <SIN256_NUM_CELLS, MOZZI_AUDIO_RATE> aVoices[NUM_VOICES];
+Oscil <SIN256_NUM_CELLS, MOZZI_CONTROL_RATE> kVibratos[NUM_VOICES];
+Oscil <TRIANGLE_WARM8192_NUM_CELLS, MOZZI_CONTROL_RATE> kBend(TRIANGLE_WARM8192_DATA);
+
+// a C major 9 chord, spread over three octaves
+const uint8_t notes[NUM_VOICES] = {36, 48, 52, 55, 59, 62, 64, 71};
+
+void setup(){
+  for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+    aVoices[i].setTable(SIN256_DATA);
+    kVibratos[i].setTable(SIN256_DATA);
+    kVibratos[i].setFreq(4.5f + 0.3f * i);  // slightly different vibrato rates
+  }
+  kBend.setFreq(0.1f);
+  startMozzi();
+}
+
+
+void updateControl(){
+  int16_t bend = kBend.next() * 4;  // +-2 semitones, in 1/256 semitones
+  for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+    int16_t vibrato = kVibratos[i].next() / 8;  // +-1/16 semitone
+    aVoices[i].setMidiNote(((Q8n8) notes[i] << 8) + bend + vibrato);
+  }
+}
+
+
+AudioOutput updateAudio(){
+  int16_t sum = 0;
+  for (uint8_t i = 0; i < NUM_VOICES; ++i) {
+    sum += aVoices[i].next();
+  }
+  return MonoOutput::fromNBit(11, sum);
+}
+
+
+void loop(){
+  audioHook();
+}
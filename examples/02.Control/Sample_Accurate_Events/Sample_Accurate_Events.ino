@@ -0,0 +1,76 @@
+/*  Example of triggering sounds at exact points in time, independent of the control rate,
+    using Mozzi sonification library.
+
+    Demonstrates MOZZI_EVENT_QUEUE_SIZE, scheduleEvent() and handleAudioEvent().
+    A short rhythm is played on two bamboo samples, at a tempo that does not
+    line up with MOZZI_CONTROL_RATE. If the samples were started from
+    updateControl(), each hit could be up to 1/64 s late, and the rhythm
+    would sound uneven. Instead, updateControl() schedules each hit for
+    its exact tick, ahead of time, and Mozzi calls handleAudioEvent()
+    right before the sample where it is due.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_EVENT_QUEUE_SIZE 8
+#include <Mozzi.h>
+#include <Sample.h>
+#include <samples/bamboo/bamboo_00_2048_int8.h>
+#include <samples/bamboo/bamboo_01_2048_int8.h>
+
+Sample <BAMBOO_00_2048_NUM_CELLS, MOZZI_AUDIO_RATE> aBamboo0(BAMBOO_00_2048_DATA);
+Sample <BAMBOO_01_2048_NUM_CELLS, MOZZI_AUDIO_RATE> aBamboo1(BAMBOO_01_2048_DATA);
+
+enum { HIT };
+const uint32_t TICKS_PER_STEP = MOZZI_AUDIO_RATE / 7;  // 7 steps per second, not a multiple of the control period
+const uint8_t pattern[] = { 0, 1, 1, 0, 1, 0, 1, 1 };  // which sample to play on each step
+uint8_t step = 0;
+uint32_t next_step_tick;
+
+void setup(){
+  aBamboo0.setFreq((float) BAMBOO_00_2048_SAMPLERATE / (float) BAMBOO_00_2048_NUM_CELLS);
+  aBamboo1.setFreq((float) BAMBOO_01_2048_SAMPLERATE / (float) BAMBOO_01_2048_NUM_CELLS);
+  // Schedule ahead by the size of the output buffer, so no event is ever late.
+  next_step_tick = MOZZI_OUTPUT_BUFFER_SIZE;
+  startMozzi();
+}
+
+
+void updateControl(){
+  // Keep events queued for the next control period (and a bit), but not more than the queue can hold.
+  while ((int32_t) (next_step_tick - audioTicks()) < (int32_t) (MOZZI_OUTPUT_BUFFER_SIZE + 2 * MOZZI_AUDIO_RATE / MOZZI_CONTROL_RATE)) {
+    if (!scheduleEvent(next_step_tick, HIT, pattern[step])) break;
+    step = (step + 1) % sizeof(pattern);
+    next_step_tick += TICKS_PER_STEP;
+  }
+}
+
+
+void handleAudioEvent(const MozziEvent &event){
+  if (event.type == HIT) {
+    if (event.param) aBamboo1.start();
+    else aBamboo0.start();
+  }
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::fromNBit(9, (int) aBamboo0.next() + aBamboo1.next());
+}
+
+
+void loop(){
+  audioHook();
+}
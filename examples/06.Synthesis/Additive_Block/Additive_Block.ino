@@ -0,0 +1,68 @@
+/*  Example of additive synthesis with a block of oscillators,
+    using Mozzi sonification library.
+
+    Demonstrates Oscil::addTo() in updateAudioBlock(). Each of 8 harmonics
+    is added to a block of samples in one go, with its own amplitude,
+    rather than calling next() for every harmonic, in every sample.
+    The harmonic amplitudes slowly drift, to give a shimmering organ sound.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_AUDIO_BLOCK_SIZE 32
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <tables/sin2048_int8.h>
+
+#define NUM_HARMONICS 8
+#define BASE_FREQ 110
+
+Oscil <SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aHarmonics[NUM_HARMONICS];
+Oscil <SIN2048_NUM_CELLS, MOZZI_CONTROL_RATE> kDrift[NUM_HARMONICS];
+uint8_t gains[NUM_HARMONICS];
+
+void setup(){
+  for (uint8_t i = 0; i < NUM_HARMONICS; ++i) {
+    aHarmonics[i].setTable(SIN2048_DATA);
+    aHarmonics[i].setFreq(BASE_FREQ * (i + 1));
+    kDrift[i].setTable(SIN2048_DATA);
+    kDrift[i].setFreq(0.1f + 0.07f * i);
+  }
+  startMozzi();
+}
+
+
+void updateControl(){
+  for (uint8_t i = 0; i < NUM_HARMONICS; ++i) {
+    // higher harmonics quieter, each drifting between 0 and its maximum
+    gains[i] = ((kDrift[i].next() + 128) >> 1) / (i + 1) + 64 / (i + 1);
+  }
+}
+
+
+void updateAudioBlock(AudioOutput* out, uint16_t n){
+  int16_t sum[MOZZI_AUDIO_BLOCK_SIZE] = { 0 };
+  for (uint8_t i = 0; i < NUM_HARMONICS; ++i) {
+    aHarmonics[i].addTo(sum, n, gains[i]);
+  }
+  for (uint16_t i = 0; i < n; ++i) {
+    out[i] = MonoOutput::fromNBit(9, sum[i]);
+  }
+}
+
+
+void loop(){
+  audioHook();
+}
@@ -0,0 +1,67 @@
+/*  Example of additive synthesis with many partials,
+    using Mozzi sonification library.
+
+    Demonstrates OscilBank, rendering blocks of samples with fill().
+    64 harmonics of a low note are summed, and their amplitudes are
+    swept by a slowly moving "formant", a peak in the spectrum which
+    travels up and down through the harmonics.
+
+    This needs a fast board (e.g. ESP32, RP2040, Teensy 3/4), AVR boards
+    will only manage a handful of partials.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_AUDIO_BLOCK_SIZE 32
+#include <Mozzi.h>
+#include <OscilBank.h>
+#include <tables/sin2048_int8.h>
+
+#define NUM_PARTIALS 64
+
+OscilBank <NUM_PARTIALS, SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aPartials(SIN2048_DATA);
+Oscil <SIN2048_NUM_CELLS, MOZZI_CONTROL_RATE> kFormant(SIN2048_DATA);
+
+void setup(){
+  aPartials.setHarmonics(55.f);
+  kFormant.setFreq(0.1f);
+  startMozzi();
+}
+
+
+void updateControl(){
+  // centre of the formant, in partials (0 to NUM_PARTIALS-1)
+  int16_t centre = ((kFormant.next() + 128) * (NUM_PARTIALS - 1)) >> 8;
+  uint8_t * amplitudes = aPartials.getAmplitudes();
+  for (int16_t i = 0; i < NUM_PARTIALS; ++i) {
+    int16_t distance = abs(i - centre);
+    amplitudes[i] = (distance < 8) ? (8 - distance) * 8 : 0;
+  }
+  amplitudes[0] = 128;  // keep the fundamental
+}
+
+
+void updateAudioBlock(AudioOutput* out, uint16_t n){
+  int16_t buf[MOZZI_AUDIO_BLOCK_SIZE];
+  aPartials.fill(buf, n);
+  for (uint16_t i = 0; i < n; ++i) {
+    out[i] = MonoOutput::fromNBit(10, buf[i]);
+  }
+}
+
+
+void loop(){
+  audioHook();
+}
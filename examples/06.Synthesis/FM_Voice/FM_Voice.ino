@@ -0,0 +1,85 @@
+/*  Example of a 4 operator FM voice, in the style of the Yamaha DX synths,
+    using Mozzi sonification library.
+
+    Demonstrates FMVoice, with algorithm 5 (two stacks of a modulator on
+    a carrier: 2 -> 1 and 4 -> 3), a classic for electric pianos. Each
+    operator's level is driven by its own envelope, so the bright attack
+    of the high "tine" modulator (operator 4) dies away quickly, leaving
+    a mellow tone.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_CONTROL_RATE 256 // Hz, fast enough for snappy envelopes
+#include <Mozzi.h>
+#include <FMVoice.h>
+#include <ADSR.h>
+#include <EventDelay.h>
+#include <tables/cos2048_int8.h>
+
+#define NUM_OPS 4
+FMVoice <NUM_OPS, 5, COS2048_NUM_CELLS, MOZZI_AUDIO_RATE> aVoice(COS2048_DATA);
+ADSR <MOZZI_CONTROL_RATE, MOZZI_CONTROL_RATE> kEnvelopes[NUM_OPS];
+EventDelay kNoteDelay;
+
+const uint8_t notes[] = {57, 60, 64, 67, 64, 60};
+uint8_t note_index = 0;
+
+void setup(){
+  // operator 1: carrier, fundamental
+  aVoice.setRatio(0, 256);
+  kEnvelopes[0].setADLevels(255, 160);
+  kEnvelopes[0].setTimes(5, 1200, 60000, 400);
+  // operator 2: modulator for a soft body
+  aVoice.setRatio(1, 256);
+  kEnvelopes[1].setADLevels(90, 40);
+  kEnvelopes[1].setTimes(5, 800, 60000, 400);
+  // operator 3: carrier, fundamental as well
+  aVoice.setRatio(2, 256);
+  kEnvelopes[2].setADLevels(200, 0);
+  kEnvelopes[2].setTimes(5, 600, 60000, 300);
+  // operator 4: high "tine", 14 times the fundamental, short
+  aVoice.setRatio(3, 14 * 256);
+  kEnvelopes[3].setADLevels(120, 0);
+  kEnvelopes[3].setTimes(2, 150, 60000, 100);
+  aVoice.setFeedback(40);
+  kNoteDelay.set(600);
+  startMozzi();
+}
+
+
+void updateControl(){
+  if (kNoteDelay.ready()) {
+    aVoice.setMidiNote((Q8n8) notes[note_index] << 8);
+    if (++note_index >= sizeof(notes)) note_index = 0;
+    aVoice.resetPhases();
+    for (uint8_t i = 0; i < NUM_OPS; ++i) kEnvelopes[i].noteOn();
+    kNoteDelay.start();
+  }
+  for (uint8_t i = 0; i < NUM_OPS; ++i) {
+    kEnvelopes[i].update();
+    aVoice.setLevel(i, kEnvelopes[i].next());
+  }
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::from16Bit(aVoice.next());
+}
+
+
+void loop(){
+  audioHook();
+}
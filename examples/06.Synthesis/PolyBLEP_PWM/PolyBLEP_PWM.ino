@@ -0,0 +1,54 @@
+/*  Example of a pulse wave with pulse width modulation,
+    using Mozzi sonification library.
+
+    Demonstrates PolyBLEPOscil, which generates sawtooth, square/pulse,
+    and triangle waves with little aliasing, and without any tables.
+    The pulse width is swept slowly by an LFO, while a band limited
+    sawtooth plays an octave lower, for a classic analog synth sound.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#include <Mozzi.h>
+#include <PolyBLEP.h>
+#include <Oscil.h>
+#include <tables/sin2048_int8.h>
+
+PolyBLEPOscil <MOZZI_AUDIO_RATE, POLYBLEP_SQUARE> aPulse;
+PolyBLEPOscil <MOZZI_AUDIO_RATE, POLYBLEP_SAW> aSaw;
+Oscil <SIN2048_NUM_CELLS, MOZZI_CONTROL_RATE> kPWM(SIN2048_DATA);
+
+void setup(){
+  aPulse.setFreq(220);
+  aSaw.setFreq(110.3f);  // slightly detuned
+  kPWM.setFreq(0.3f);
+  startMozzi();
+}
+
+
+void updateControl(){
+  // sweep the pulse width between about 10% and 90%
+  aPulse.setPulseWidth(32768 + kPWM.next() * 200);
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::from16Bit(((int32_t) aPulse.next() + aSaw.next()) >> 1);
+}
+
+
+void loop(){
+  audioHook();
+}
@@ -0,0 +1,64 @@
+/*  Example of a detuned "supersaw" in stereo,
+    using Mozzi sonification library.
+
+    Demonstrates Unison, which plays 7 detuned copies of a sawtooth
+    wave, spread over the left and right channels. The detuning is
+    swept slowly by an LFO, from a gentle chorus to a wide, dense
+    swarm, while a short bass line plays.
+
+    Circuit: Audio output on digital pins 9 and 10 on a Uno or similar, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_AUDIO_CHANNELS MOZZI_STEREO
+#include <Mozzi.h>
+#include <Unison.h>
+#include <EventDelay.h>
+#include <tables/saw2048_int8.h>
+#include <tables/sin256_int8.h>
+
+Unison <7, SAW2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSuperSaw(SAW2048_DATA);
+Oscil <SIN256_NUM_CELLS, MOZZI_CONTROL_RATE> kDetune(SIN256_DATA);
+EventDelay kNoteDelay;
+
+const uint8_t notes[] = {45, 45, 48, 43};
+uint8_t note_index = 0;
+
+void setup(){
+  aSuperSaw.setMix(200);  // outer voices a little softer than the centre
+  kDetune.setFreq(0.05f);
+  kNoteDelay.set(1000);
+  startMozzi();
+}
+
+
+void updateControl(){
+  if (kNoteDelay.ready()) {
+    aSuperSaw.setMidiNote((Q8n8) notes[note_index] << 8);
+    if (++note_index >= sizeof(notes)) note_index = 0;
+    kNoteDelay.start();
+  }
+  aSuperSaw.setDetune(kDetune.next() / 2 + 68);  // 4 to 131, i.e. about 2 to 55 cents between neighbouring voices
+}
+
+
+AudioOutput updateAudio(){
+  int16_t left, right;
+  aSuperSaw.nextStereo(left, right);
+  return StereoOutput::fromNBit(10, left, right);
+}
+
+
+void loop(){
+  audioHook();
+}
@@ -0,0 +1,61 @@
+/*  Example of sweeping smoothly through a set of waveforms,
+    using Mozzi sonification library.
+
+    Demonstrates WavetableScanner, which plays a mix of two adjacent
+    tables out of an ordered set, at any position in between.
+    A slow LFO scans from sine to triangle to sawtooth to square
+    and back, without the clicks of switching tables.
+
+    The tables can also be one contiguous array of frames, as in most
+    wavetable synthesizers, see WavetableScanner::setFrames().
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#include <Mozzi.h>
+#include <WavetableScanner.h>
+#include <tables/sin2048_int8.h>
+#include <tables/triangle2048_int8.h>
+#include <tables/saw2048_int8.h>
+#include <tables/square_no_alias_2048_int8.h>
+
+#define NUM_TABLES 4
+const int8_t * const tables[NUM_TABLES] = {SIN2048_DATA, TRIANGLE2048_DATA, SAW2048_DATA, SQUARE_NO_ALIAS_2048_DATA};
+
+WavetableScanner <2048, MOZZI_AUDIO_RATE> aScanner(tables, NUM_TABLES);
+Oscil <SIN2048_NUM_CELLS, MOZZI_CONTROL_RATE> kScan(SIN2048_DATA);
+
+void setup(){
+  aScanner.setMidiNote(48 << 8);
+  kScan.setFreq(0.1f);
+  startMozzi();
+}
+
+
+void updateControl(){
+  // from 0 (the first table) to 3 (the last), in Q8n8 format
+  Q8n8 position = ((int16_t) kScan.next() + 128) * 3;
+  aScanner.setMorph(position);
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::from8Bit(aScanner.next());
+}
+
+
+void loop(){
+  audioHook();
+}
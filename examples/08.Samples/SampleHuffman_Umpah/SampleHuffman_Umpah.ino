@@ -1,15 +1,19 @@
 /*
  Example playing samples encoded with Huffman compression.
 
- Demonstrates the SampleHuffman class.
+ Demonstrates the SampleHuffman class, slicing the compressed drum loop
+ into beats, and playing them in a shuffled order, using the seek index,
+ with some beats played at half speed, an octave down.
  SampleHuffman, most of this explanation, and the audio2huff.py script are adapted from "audioout",
  an Arduino sketch by Thomas Grill, 2011 http//grrrr.org.
 
  Huffman decoding is used on sample differentials,
  saving 50-70% of space for 8 bit data, depending on the sample rate.
 
- This implementation just plays back one sample each time next() is called, with no
- speed or other adjustments.  It's slow, so it's likely you will only be able to play one sound at a time.
+ By default, SampleHuffman plays back one sample each time next() is called. setSpeed()
+ changes the playback speed (pitch), as done here for the half speed beats.  Decoding bit by bit is slow, so it's likely you will only be able to
+ play one sound at a time. Passing the HUFFMAN_LUT lookup table to SampleHuffman, as done here,
+ decodes most samples in one step, which is considerably faster.
 
  Audio data, Huffman decoder table, sample rate and bit depth are defined
  in a sounddata.h header file.  This file can be generated for a sound file with the
@@ -29,6 +33,8 @@
  The header file contains two lengthy arrays:
  One is "SOUNDDATA" which must fit into Flash RAM (available in total: 32k for ATMega328)
  The other is "HUFFMAN" which must also fit into Flash RAM
+ The lookup table "HUFFMAN_LUT" is optional. Here, it was made with --lutbits=6, to save Flash RAM.
+ So is the seek index "SEEK_BITS" / "SEEK_VALUES", made with --seekinterval=1024, here.
 
  Circuit:
   Audio output on digital pin 9 on a Uno or similar, or
@@ -48,17 +54,35 @@
 
 #include <Mozzi.h>
 #include <SampleHuffman.h>
+#include <EventDelay.h>
+#include <mozzi_rand.h>
 #include "umpah_huff.h"
 
-SampleHuffman umpah(UMPAH_SOUNDDATA,UMPAH_HUFFMAN,UMPAH_SOUNDDATA_BITS);
+SampleHuffman umpah(UMPAH_SOUNDDATA,UMPAH_HUFFMAN,UMPAH_SOUNDDATA_BITS,UMPAH_HUFFMAN_LUT,UMPAH_HUFFMAN_LUT_BITS);
+EventDelay kSliceDelay;
+
+const uint32_t SLICE_LENGTH = 4096; // samples, one beat of the loop
+const uint8_t NUM_SLICES = UMPAH_NUM_SAMPLES / SLICE_LENGTH;
+uint8_t slice = 0;
 
 void setup() {
-  umpah.setLoopingOn();
+  // without the seek index, start(offset) would decode the sample from the beginning up to offset
+  umpah.setSeekIndex(UMPAH_SEEK_BITS,UMPAH_SEEK_VALUES,UMPAH_SEEK_INTERVAL,UMPAH_NUM_SAMPLES);
+  kSliceDelay.set(SLICE_LENGTH * 1000 / MOZZI_AUDIO_RATE); // one sample per audio tick
   startMozzi();
 }
 
 
 void updateControl(){
+  if(kSliceDelay.ready()){
+    // mostly play the loop in order, but sometimes jump to a random beat
+    uint8_t play = (rand((byte)4) == 0) ? rand(NUM_SLICES) : slice;
+    umpah.setSpeed((rand((byte)8) == 0) ? 128 : 256); // Q8n8, 256 is the original speed
+    umpah.start(play * SLICE_LENGTH);
+    umpah.setEnd((play + 1) * SLICE_LENGTH);
+    if(++slice >= NUM_SLICES) slice = 0;
+    kSliceDelay.start();
+  }
 }
 
 
@@ -19,7 +19,24 @@ CONSTTABLE_STORAGE(int16_t) UMPAH_HUFFMAN[280] = {
 13,0,-9,10,4,0,-24,0,-29,4,0,28,0,24,19,16,0,6,13,0,11,10,7,0,34,4,0,38,0,-42,0,27,0,-5,43,40,19,7,4,0,
 -22,0,-27,0,12,10,4,0,-30,0,29,4,0,30,0,26,19,16,13,0,-28,10,0,33,7,4,0,42,0,-44,0,43,0,14,0,7,0,-3,0,0
 };
+#define UMPAH_HUFFMAN_LUT_BITS 6
+CONSTTABLE_STORAGE(int16_t) UMPAH_HUFFMAN_LUT[128] = {
+4,1,4,1,4,1,4,1,0,8,0,37,6,4,0,57,5,3,5,3,5,-2,5,-2,0,79,6,-4,0,132,0,155,4,-1,4,-1,4,-1,4,-1,
+4,2,4,2,4,2,4,2,0,181,0,201,0,216,6,-5,0,237,0,257,5,-3,5,-3,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0
+};
 uint32_t const UMPAH_SOUNDDATA_BITS = 196860L;
+#define UMPAH_NUM_SAMPLES 48746L
+#define UMPAH_SEEK_INTERVAL 1024
+CONSTTABLE_STORAGE(uint32_t) UMPAH_SEEK_BITS[48] = {
+0,9011,18191,26569,34292,40918,46484,50865,54534,58298,63309,67745,69968,73007,78072,81767,83433,86635,92115,96932,99305,100620,101914,103244,104484,106853,110832,114655,116657,118035,119248,120437,121614,129630,138339,146591,154177,160837,166671,171591,
+175786,179482,183526,188454,191853,193504,194825,196113
+};
+CONSTTABLE_STORAGE(int16_t) UMPAH_SEEK_VALUES[48] = {
+0,30,-20,-61,6,-5,1,-2,0,34,-29,4,-1,14,-14,7,-1,43,-36,5,-1,-2,0,0,0,-6,23,7,1,-1,0,-1,0,-31,23,-10,7,-4,2,-2,
+1,0,-12,9,3,0,-1,-1
+};
 CONSTTABLE_STORAGE(byte) UMPAH_SOUNDDATA[] = {
 210,20,130,2,84,176,64,164,16,40,8,29,42,245,148,33,72,34,0,32,104,132,68,82,192,164,66,170,80,100,40,32,2,104,165,134,133,104,242,140,
 60,194,228,96,20,116,96,79,41,213,219,49,158,86,27,9,182,8,180,122,58,107,156,155,98,8,22,112,138,113,114,152,128,140,117,60,130,208,161,20,
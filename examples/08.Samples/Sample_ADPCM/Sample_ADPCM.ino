@@ -0,0 +1,62 @@
+/*  Example of playing a sampled sound compressed with ADPCM,
+    using Mozzi sonification library.
+
+    Demonstrates SampleADPCM, which stores samples in 4 bits each,
+    i.e. half the space of the 8 bit sample played in the Sample example,
+    scheduled with EventDelay. Every other time, the sample is started
+    from the middle, which is fast, as decoding can start from any block
+    of the compressed data.
+
+    The sample was made with the adpcm2mozzi.py script, in Mozzi/extras/python/:
+    python3 adpcm2mozzi.py --samplerate 16384 burroughs1_18649.raw burroughs1_18649_adpcm.h BURROUGHS1_18649_ADPCM
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+   Mozzi documentation/API
+   https://sensorium.github.io/Mozzi/doc/html/index.html
+
+   Mozzi help/discussion/announcements:
+   https://groups.google.com/forum/#!forum/mozzi-users
+
+   Copyright 2024 the Mozzi Team
+
+   Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#include <Mozzi.h>
+#include <SampleADPCM.h>
+#include <samples/burroughs1_18649_adpcm.h>
+#include <EventDelay.h>
+
+// use: SampleADPCM <samples per block> SampleName (data, number of samples)
+SampleADPCM <BURROUGHS1_18649_ADPCM_BLOCK_SAMPLES> aSample(BURROUGHS1_18649_ADPCM_DATA, BURROUGHS1_18649_ADPCM_NUM_CELLS);
+
+// for scheduling sample start
+EventDelay kTriggerDelay;
+bool from_middle = false;
+
+void setup(){
+  startMozzi();
+  kTriggerDelay.set(1500); // 1500 msec countdown, within resolution of MOZZI_CONTROL_RATE
+}
+
+
+void updateControl(){
+  if(kTriggerDelay.ready()){
+    aSample.start(from_middle ? BURROUGHS1_18649_ADPCM_NUM_CELLS / 2 : 0);
+    from_middle = !from_middle;
+    kTriggerDelay.start();
+  }
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::from16Bit(aSample.next());
+}
+
+
+void loop(){
+  audioHook();
+}
@@ -0,0 +1,77 @@
+/*  Example of streaming a sample through a double buffer in RAM,
+    as needed for playing samples from external storage,
+    using Mozzi sonification library.
+
+    Demonstrates StreamingSample. To keep this example self contained,
+    the "external storage" is just a sample in flash, read with
+    MemoryBlockSource. For an SD card, SPI flash, or any other storage,
+    write a block source class with a read() function, as shown in the
+    documentation of StreamingSample, and use that instead.
+
+    Blocks are read in updateControl(). Once per second, the number of
+    underruns (repeated samples, as a block was late), and the prefetch
+    margin (the fewest samples left to play when a block arrived) are
+    printed to the Serial monitor. Increase MOZZI_CONTROL_RATE, or the
+    buffer size, if the margin drops to 0.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+   Mozzi documentation/API
+   https://sensorium.github.io/Mozzi/doc/html/index.html
+
+   Mozzi help/discussion/announcements:
+   https://groups.google.com/forum/#!forum/mozzi-users
+
+   Copyright 2024 the Mozzi Team
+
+   Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_CONTROL_RATE 128 // Hz: update() is called often enough, even at an audio rate of 32768 Hz
+#include <Mozzi.h>
+#include <StreamingSample.h>
+#include <samples/burroughs1_18649_int8.h>
+#include <EventDelay.h>
+
+MemoryBlockSource source(BURROUGHS1_18649_DATA, BURROUGHS1_18649_NUM_CELLS);
+// use: StreamingSample <source class, buffer size> SampleName (source)
+StreamingSample <MemoryBlockSource, 512> aSample(source);  // 2 * 512 bytes of RAM
+
+EventDelay kTriggerDelay;
+EventDelay kReportDelay;
+
+void setup(){
+  Serial.begin(115200);
+  startMozzi();
+  kTriggerDelay.set(1500); // 1500 msec countdown, within resolution of MOZZI_CONTROL_RATE
+  kReportDelay.set(1000);
+}
+
+
+void updateControl(){
+  aSample.update(); // read the next block, if there is room for it
+  if(kTriggerDelay.ready()){
+    aSample.start(); // reads the first block right away
+    kTriggerDelay.start();
+  }
+  if(kReportDelay.ready()){
+    Serial.print("underruns: ");
+    Serial.print(aSample.getUnderruns());
+    Serial.print(", prefetch margin: ");
+    Serial.println(aSample.getPrefetchMargin());
+    aSample.resetStatistics();
+    kReportDelay.start();
+  }
+}
+
+
+AudioOutput updateAudio(){
+  return MonoOutput::from8Bit(aSample.next());
+}
+
+
+void loop(){
+  audioHook();
+}
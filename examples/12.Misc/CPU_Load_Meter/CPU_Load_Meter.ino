@@ -0,0 +1,82 @@
+/*  Example of measuring how much CPU time a sketch uses,
+    using Mozzi sonification library.
+
+    Demonstrates MOZZI_LOAD_METER, mozziCpuLoad() and friends.
+    A number of sine waves is played, and the number of voices
+    can be changed via the Serial monitor (send '+' or '-').
+    Once per second, the load is printed. Watch how the load
+    increases with each voice, and the underrun counter starts
+    to climb, once the board can no longer keep up.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_LOAD_METER MOZZI_LOAD_METER_ENABLED
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <tables/sin2048_int8.h>
+
+#define MAX_VOICES 16
+Oscil <SIN2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSin[MAX_VOICES];
+uint8_t num_voices = 4;
+
+void setup(){
+  Serial.begin(115200);
+  for (uint8_t i = 0; i < MAX_VOICES; ++i) {
+    aSin[i].setTable(SIN2048_DATA);
+    aSin[i].setFreq(110 + i * 55);
+  }
+  startMozzi();
+}
+
+
+void updateControl(){
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c == '+' && num_voices < MAX_VOICES) ++num_voices;
+    if (c == '-' && num_voices > 1) --num_voices;
+  }
+
+  static uint8_t count = 0;
+  if (++count >= MOZZI_CONTROL_RATE) {  // about once per second
+    count = 0;
+    Serial.print(num_voices);
+    Serial.print(" voices, load: ");
+    Serial.print(mozziCpuLoad());
+    Serial.print(" avg cycles: ");
+    Serial.print(mozziAverageCycles());
+    Serial.print(" peak cycles: ");
+    Serial.print(mozziPeakCycles());
+    Serial.print(" underruns: ");
+    Serial.print(mozziUnderruns());
+    Serial.print(" buffer low-water: ");
+    Serial.println(mozziBufferLowWater());
+    mozziResetLoadMeter();
+  }
+}
+
+
+AudioOutput updateAudio(){
+  int16_t sum = 0;
+  for (uint8_t i = 0; i < num_voices; ++i) {
+    sum += aSin[i].next();
+  }
+  return MonoOutput::fromNBit(12, sum);
+}
+
+
+void loop(){
+  audioHook();
+}
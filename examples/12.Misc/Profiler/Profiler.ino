@@ -0,0 +1,71 @@
+/*  Example of finding out, where a sketch spends its CPU time,
+    using Mozzi sonification library.
+
+    Demonstrates MOZZI_PROFILER, MOZZI_PROFILE_SCOPE() and
+    mozziProfileReport(). A filtered saw wave is played through
+    a reverb. Once every few seconds, the number of calls and
+    the CPU cycles spent in each unit are printed to the Serial monitor.
+    Oscil::next(), ResonantFilter::next() and ReverbTank::next()
+    are instrumented by Mozzi, already, while updateAudio() as
+    a whole is marked, here.
+
+    Circuit: Audio output on digital pin 9 on a Uno or similar, or
+    DAC/A14 on Teensy 3.1, or
+    check the README or http://sensorium.github.io/Mozzi/
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_PROFILER MOZZI_PROFILER_ENABLED
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <ResonantFilter.h>
+#include <ReverbTank.h>
+#include <tables/saw2048_int8.h>
+#include <tables/cos2048_int8.h>
+
+Oscil <SAW2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSaw(SAW2048_DATA);
+Oscil <COS2048_NUM_CELLS, MOZZI_CONTROL_RATE> kCutoff(COS2048_DATA);
+LowPassFilter lpf;
+ReverbTank reverb;
+
+void setup(){
+  Serial.begin(115200);
+  aSaw.setFreq(110);
+  kCutoff.setFreq(0.3f);
+  lpf.setResonance(200);
+  startMozzi();
+}
+
+
+void updateControl(){
+  lpf.setCutoffFreq(128 + kCutoff.next());
+
+  static uint16_t count = 0;
+  if (++count >= 5 * MOZZI_CONTROL_RATE) {  // about every five seconds
+    count = 0;
+    mozziProfileReport(Serial);
+    Serial.println();
+    mozziProfileReset();
+  }
+}
+
+
+AudioOutput updateAudio(){
+  MOZZI_PROFILE_SCOPE("updateAudio");
+  int8_t filtered = lpf.next(aSaw.next());
+  return MonoOutput::fromNBit(9, filtered + (reverb.next(filtered) >> 3));
+}
+
+
+void loop(){
+  audioHook();
+}
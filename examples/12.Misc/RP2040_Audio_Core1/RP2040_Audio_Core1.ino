@@ -0,0 +1,85 @@
+/*  Example of running Mozzi on the second core of an RP2040 (Raspberry Pi Pico),
+    using Mozzi sonification library.
+
+    Demonstrates MOZZI_RP2040_AUDIO_CORE, and passing control parameters
+    from one core to the other with a Mailbox.
+
+    With MOZZI_RP2040_AUDIO_CORE set to 1, updateAudio() and updateControl()
+    run on core 1, while loop() keeps core 0 all to itself. Here, loop()
+    just reads a knob and prints something, slowly, to stand in for
+    the USB MIDI, display, or networking code of a real project.
+
+    Since loop() and updateControl() run on different cores, parameters
+    are passed through a Mailbox, rather than via plain global variables.
+
+    This example works on RP2040, only.
+
+    Circuit: Audio output on GPIO 0 (see the RP2040 section of the Mozzi
+    documentation for other output options).
+    Potentiometer on A0 (GPIO 26).
+
+    Mozzi documentation/API
+    https://sensorium.github.io/Mozzi/doc/html/index.html
+
+    Mozzi help/discussion/announcements:
+    https://groups.google.com/forum/#!forum/mozzi-users
+
+    Copyright 2024 the Mozzi Team
+
+    Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+*/
+
+#define MOZZI_RP2040_AUDIO_CORE 1  // render audio on core 1
+#define MOZZI_ANALOG_READ MOZZI_ANALOG_READ_NONE  // we'll use plain analogRead() on core 0, instead
+#include <Mozzi.h>
+#include <Oscil.h>
+#include <Mailbox.h>
+#include <tables/saw2048_int8.h>
+
+Oscil <SAW2048_NUM_CELLS, MOZZI_AUDIO_RATE> aSaw(SAW2048_DATA);
+
+struct SynthParams {
+  uint16_t freq;
+  uint8_t gain;
+};
+Mailbox<SynthParams> params_mailbox;
+
+uint8_t gain = 255;   // only used on core 1
+
+void setup(){
+  Serial.begin(115200);
+  aSaw.setFreq(110);
+  startMozzi();
+}
+
+
+void updateControl(){  // runs on core 1
+  SynthParams params;
+  if (params_mailbox.fetch(params)) {
+    aSaw.setFreq((int) params.freq);
+    gain = params.gain;
+  }
+}
+
+
+AudioOutput updateAudio(){  // runs on core 1
+  return MonoOutput::from16Bit(aSaw.next() * gain);
+}
+
+
+void loop(){  // runs on core 0
+  int knob = analogRead(A0);
+  SynthParams params = { (uint16_t) (55 + (knob >> 2)), 200 };
+  params_mailbox.post(params);
+
+  static unsigned long last_print = 0;
+  if (millis() - last_print > 1000) {
+    last_print = millis();
+    Serial.print("freq: ");
+    Serial.print(params.freq);
+    Serial.print(" audio ticks: ");
+    Serial.println(audioTicks());
+  }
+
+  audioHook(); // does nothing in this mode, but keeps the sketch portable
+}
@@ -0,0 +1,104 @@
+/*
+ * Arduino.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+/* Minimal stand-in for the Arduino core API, for compiling Mozzi sketches as desktop programs (see @ref hardware_host).
+ * Only what is needed by Mozzi itself and by typical sketches is provided. Add this directory to the include path of
+ * host builds, only: It must never end up in the include path of a real Arduino build. */
+
+#ifndef MOZZI_HOST_ARDUINO_H
+#define MOZZI_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+#define PROGMEM
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+enum { A0 = 14, A1, A2, A3, A4, A5, A6, A7 };
+
+#define PI 3.1415926535897932384626433832795
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+// Defined by the host implementation: These follow the rendered audio, not the wall clock.
+unsigned long millis();
+unsigned long micros();
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+inline int analogRead(uint8_t) { return 0; }
+inline void analogWrite(uint8_t, int) {}
+inline void noInterrupts() {}  // no interrupts on the host: output runs in audioHook()
+inline void interrupts() {}
+
+inline long random(long howbig) { return howbig ? (::random() % howbig) : 0; }
+inline long random(long howsmall, long howbig) { return (howsmall >= howbig) ? howsmall : howsmall + random(howbig - howsmall); }
+inline void randomSeed(unsigned long seed) { srandom(seed); }
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) { return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min; }
+
+/** Just enough of Arduino's Print class to make debug output from sketches work. Output goes to stderr, as stdout may be carrying audio. */
+class Print {
+public:
+	Print(FILE *stream = stderr) : stream(stream) {}
+	size_t print(const char *s) { return fprintf(stream, "%s", s); }
+	size_t print(char c) { return fprintf(stream, "%c", c); }
+	size_t print(long n, int base = DEC) { return (base == HEX) ? fprintf(stream, "%lx", n) : fprintf(stream, "%ld", n); }
+	size_t print(unsigned long n, int base = DEC) { return (base == HEX) ? fprintf(stream, "%lx", n) : fprintf(stream, "%lu", n); }
+	size_t print(int n, int base = DEC) { return print((long) n, base); }
+	size_t print(unsigned int n, int base = DEC) { return print((unsigned long) n, base); }
+	size_t print(unsigned char n, int base = DEC) { return print((unsigned long) n, base); }
+	size_t print(long long n, int base = DEC) { return print((long) n, base); }
+	size_t print(unsigned long long n, int base = DEC) { return print((unsigned long) n, base); }
+	size_t print(double n, int digits = 2) { return fprintf(stream, "%.*f", digits, n); }
+	template<typename T> size_t println(T value) { size_t ret = print(value); return ret + println(); }
+	template<typename T> size_t println(T value, int format) { size_t ret = print(value, format); return ret + println(); }
+	size_t println() { return print('\n'); }
+private:
+	FILE *stream;
+};
+
+class HostSerial : public Print {
+public:
+	void begin(unsigned long) {}
+	int available() { return 0; }
+	int read() { return -1; }
+	operator bool() { return true; }
+};
+static HostSerial Serial;
+
+// Provided by the sketch
+void setup();
+void loop();
+
+#endif
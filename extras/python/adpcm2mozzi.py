@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+
+##@file adpcm2mozzi.py
+#  @ingroup util
+#	A script for converting sound files to IMA ADPCM compressed samples for Mozzi's SampleADPCM, at 4 bits per sample.
+#
+#	Usage:
+#	>>>adpcm2mozzi.py [--samplerate RATE] [--block-samples N] <infile outfile tablename>
+#
+#	@param infile		The file to convert: a WAV file (8 or 16 bit PCM, stereo is mixed down to mono),
+#				or any other file is read as RAW (headerless) signed 8 bit PCM, like for char2mozzi.py.
+#	@param outfile	The file to save as output, a .h file containing the compressed sample for Mozzi.
+#	@param tablename	The name to give the table of compressed data in the new file.
+#	@param --samplerate	The samplerate the sound was recorded at. Taken from the file for WAV files, required for RAW files.
+#	@param --block-samples	Samples per block, a power of two (default 256). Must match the BLOCK_SAMPLES template parameter of
+#				SampleADPCM. Each block starts with a 3 byte header, from which decoding (and seeking) can start.
+#
+#	Only the Python 3 standard library is needed.
+#
+#	@author the Mozzi Team 2024
+#	@fn adpcm2mozzi
+
+import argparse, array, math, os, sys, textwrap, wave
+
+STEP_TABLE = [
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+	157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552,
+	1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+	12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+def read_samples(infile, samplerate):
+	"""returns the sound as a list of 16 bit values, and its sample rate"""
+	if infile.lower().endswith('.wav'):
+		w = wave.open(infile, 'rb')
+		channels, width, rate, frames = w.getnchannels(), w.getsampwidth(), w.getframerate(), w.getnframes()
+		raw = w.readframes(frames)
+		w.close()
+		if width == 1:
+			values = [(b - 128) << 8 for b in raw]  # 8 bit WAV is unsigned
+		elif width == 2:
+			values = array.array('h', raw)
+			if sys.byteorder == 'big':
+				values.byteswap()
+			values = values.tolist()
+		else:
+			sys.exit('Error: only 8 and 16 bit WAV files are supported')
+		# mix down multi-channel audio
+		values = [sum(values[i:i + channels]) // channels for i in range(0, len(values), channels)]
+		return values, samplerate or rate
+	if not samplerate:
+		sys.exit('Error: --samplerate is required for RAW files')
+	with open(infile, 'rb') as fin:
+		values = array.array('b', fin.read()).tolist()
+	return [v << 8 for v in values], samplerate
+
+def decode_nibble(nibble, predicted, index):
+	"""one step of the decoder, exactly as in SampleADPCM::step()"""
+	step = STEP_TABLE[index]
+	difference = step >> 3
+	if nibble & 4: difference += step
+	if nibble & 2: difference += step >> 1
+	if nibble & 1: difference += step >> 2
+	predicted = predicted - difference if nibble & 8 else predicted + difference
+	predicted = max(-32768, min(32767, predicted))
+	index = max(0, min(88, index + INDEX_TABLE[nibble & 7]))
+	return predicted, index
+
+def encode_sample(value, predicted, index):
+	step = STEP_TABLE[index]
+	difference = value - predicted
+	nibble = 0
+	if difference < 0:
+		nibble = 8
+		difference = -difference
+	if difference >= step:
+		nibble |= 4
+		difference -= step
+	if difference >= step >> 1:
+		nibble |= 2
+		difference -= step >> 1
+	if difference >= step >> 2:
+		nibble |= 1
+	return nibble
+
+def encode(values, block_samples):
+	"""returns the compressed data, and the decoded sound, for checking"""
+	data = []
+	decoded = []
+	index = 0
+	for start in range(0, len(values), block_samples):
+		# start each block from the previous original value, so errors do not carry on to the next block
+		predicted = values[start - 1] if start else values[0]
+		data += [predicted & 255, (predicted >> 8) & 255, index]
+		block = values[start:start + block_samples]
+		if len(block) & 1:
+			block = block + [block[-1]]  # pad to whole bytes
+		nibbles = []
+		for value in block:
+			nibble = encode_sample(value, predicted, index)
+			predicted, index = decode_nibble(nibble, predicted, index)
+			nibbles.append(nibble)
+			decoded.append(predicted)
+		data += [nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2)]
+	return data, decoded[:len(values)]
+
+def adpcm2mozzi(infile, outfile, tablename, samplerate, block_samples):
+	values, samplerate = read_samples(os.path.expanduser(infile), samplerate)
+	print ("opened " + infile + ", " + str(len(values)) + " samples")
+	data, decoded = encode(values, block_samples)
+	noise = sum((a - b) ** 2 for a, b in zip(values, decoded))
+	signal = sum(a * a for a in values)
+	if noise and signal:
+		print ("signal to noise ratio: %.1f dB" % (10 * math.log10(float(signal) / noise)))
+	print ("compressed size: " + str(len(data)) + " bytes")
+
+	fout = open(os.path.expanduser(outfile), "w")
+	fout.write('#ifndef ' + tablename + '_H_' + '\n')
+	fout.write('#define ' + tablename + '_H_' + '\n \n')
+	fout.write('#include <Arduino.h>'+'\n')
+	fout.write('#include "mozzi_pgmspace.h"'+'\n \n')
+	fout.write('#define ' + tablename + '_NUM_CELLS '+ str(len(values))+'\n')
+	fout.write('#define ' + tablename + '_SAMPLERATE '+ str(samplerate)+'\n')
+	fout.write('#define ' + tablename + '_BLOCK_SAMPLES '+ str(block_samples)+'\n \n')
+	outstring = 'CONSTTABLE_STORAGE(uint8_t) ' + tablename + '_DATA [] = {'
+	outstring += ", ".join(str(d) for d in data) + "};"
+	outstring = textwrap.fill(outstring, 80)
+	fout.write(outstring)
+	fout.write('\n\n#endif /* ' + tablename + '_H_ */\n')
+	fout.close()
+	print ("wrote " + outfile)
+
+if __name__ == "__main__":
+	parser = argparse.ArgumentParser(description='Convert a sound file to an IMA ADPCM compressed sample for Mozzi\'s SampleADPCM.')
+	parser.add_argument('infile', help='WAV file (8 or 16 bit), or RAW signed 8 bit data')
+	parser.add_argument('outfile', help='.h file to write')
+	parser.add_argument('tablename', help='name of the table, and prefix of the constants')
+	parser.add_argument('--samplerate', type=int, default=0, help='sample rate, required for RAW files')
+	parser.add_argument('--block-samples', type=int, default=256, help='samples per block, a power of two (default 256)')
+	args = parser.parse_args()
+	if args.block_samples < 2 or args.block_samples & (args.block_samples - 1):
+		sys.exit('Error: --block-samples must be a power of two')
+	adpcm2mozzi(args.infile, args.outfile, args.tablename, args.samplerate, args.block_samples)
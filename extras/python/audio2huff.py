@@ -11,6 +11,10 @@
 # - changed all constant names to upper case
 # - added include guards, Arduino and avr includes
 #
+# Modified by the Mozzi Team 2024
+# - added HUFFMAN_LUT lookup table for decoding several bits at once (--lutbits)
+# - added SEEK index of checkpoints for fast seeking (--seekinterval), and NUM_SAMPLES
+#
 # Dependencies:
 # Numerical Python (numpy): http://numpy.scipy.org/
 # scikits.audiolab: http://pypi.python.org/pypi/scikits.audiolab/
@@ -58,6 +62,45 @@ def arrayformatter(seq,perline=40):
     """format list output linewise"""
     return ",\n".join(",".join(imap(str,s)) for s in grouper(perline,seq))
 
+def huffman_lut(huff,lutbits):
+    """lookup table for decoding lutbits bits of the stream at once, derived from the decoder table:
+    for each bit pattern, a pair of (code length, value) if a code ends within lutbits bits,
+    or (0, position in the decoder table after lutbits bits) for the longer codes"""
+    lut = []
+    for pattern in xrange(2**lutbits):
+        pos = 0
+        for i in xrange(lutbits):
+            # same steps as SampleHuffman::walk()
+            if (pattern>>(lutbits-1-i))&1:
+                offs = huff[pos]
+                pos += offs+1 if offs else 2
+            pos += 1
+            if not huff[pos-1]:
+                lut += [i+1,huff[pos]]
+                break
+        else:
+            lut += [0,pos]
+    return lut
+
+def seek_index(dsound,codelen,interval):
+    """checkpoints every interval samples, for starting to decode in the middle of the stream:
+    the bit position of the code of sample k*interval, and the sum of all differentials before it"""
+    bits = []
+    values = []
+    bitpos = 0
+    value = 0
+    for i,v in enumerate(dsound):
+        if i%interval == 0:
+            bits.append(bitpos)
+            values.append(value)
+        bitpos += codelen[v]
+        value += v
+    if len(dsound)%interval == 0:
+        # checkpoint at the very end, for seeking to NUM_SAMPLES
+        bits.append(bitpos)
+        values.append(value)
+    return bits,values
+
 if __name__ == "__main__":
     from optparse import OptionParser
     parser = OptionParser()
@@ -66,12 +109,18 @@ if __name__ == "__main__":
     parser.add_option("--hdrfile", dest="hdrfile",help="output C header file")
     parser.add_option("--name", dest="name",help="prefix for tables and constants in file")
     parser.add_option("--plothist", type="int", default=0, dest="plothist",help="plot histogram")
+    parser.add_option("--lutbits", type="int", default=8, dest="lutbits",help="bits per lookup for fast decoding, 4 to 8, or 0 for no lookup table")
+    parser.add_option("--seekinterval", type="int", default=256, dest="seekinterval",help="samples between checkpoints of the seek index, or 0 for no seek index")
     (options, args) = parser.parse_args()
 
     if not options.sndfile:
         print >>sys.stderr,"Error: --sndfile argument required"
         exit(-1)
 
+    if options.lutbits and not 4 <= options.lutbits <= 8:
+        print >>sys.stderr,"Error: --lutbits must be between 4 and 8, or 0"
+        exit(-1)
+
     sndf = Sndfile(options.sndfile,'r')
     sound = sndf.read_frames(sndf.nframes)
     fs = sndf.samplerate
@@ -121,6 +170,18 @@ if __name__ == "__main__":
     print >>sys.stderr,"ratio: %.0f%%"%((len(enc)*100.)/(len(sound8)*8))
     print >>sys.stderr,"decoder length: %.0f words"%(len(decoder.huff))
 
+    codelen = dict((v,len(encoder([v]))) for v in set(dsound8))
+
+    if options.seekinterval:
+        seekbits,seekvalues = seek_index(dsound8,codelen,options.seekinterval)
+        print >>sys.stderr,"seek index: %i checkpoints"%len(seekbits)
+
+    if options.lutbits:
+        lut = huffman_lut(decoder.huff,options.lutbits)
+        # share of samples which need more than one lookup, i.e. decoding bit by bit after the lookup
+        slow = sum(1 for v in dsound8 if codelen[v] > options.lutbits)
+        print >>sys.stderr,"longest code: %i bits, longer than lookup: %.1f%% of samples"%(max(codelen.itervalues()),(slow*100.)/len(dsound8))
+
     if options.hdrfile:
         hdrf = file(options.hdrfile,'wt')
         print >>hdrf,"// generated by Mozzi/extras/python/audio2huff.py \n"
@@ -131,7 +192,15 @@ if __name__ == "__main__":
         print >>hdrf,'#include "mozzi_pgmspace.h"\n \n'
         print >>hdrf,"#define " + options.name + "_SAMPLERATE %i"%fs
         print >>hdrf,"#define " + options.name + "_SAMPLE_BITS %i"%options.bits
-        print >>hdrf,'CONSTTABLE_STORAGE(int) ' + options.name + '_HUFFMAN[%i] = {\n%s\n};'%(len(decoder.huff),arrayformatter(decoder.huff))
+        print >>hdrf,'CONSTTABLE_STORAGE(int16_t) ' + options.name + '_HUFFMAN[%i] = {\n%s\n};'%(len(decoder.huff),arrayformatter(decoder.huff))
+        if options.lutbits:
+            print >>hdrf,"#define " + options.name + "_HUFFMAN_LUT_BITS %i"%options.lutbits
+            print >>hdrf,'CONSTTABLE_STORAGE(int16_t) ' + options.name + '_HUFFMAN_LUT[%i] = {\n%s\n};'%(len(lut),arrayformatter(lut))
         print >>hdrf,'unsigned long const ' + options.name + '_SOUNDDATA_BITS = %iL;'%len(enc)
+        print >>hdrf,"#define " + options.name + "_NUM_SAMPLES %iL"%len(dsound8)
+        if options.seekinterval:
+            print >>hdrf,"#define " + options.name + "_SEEK_INTERVAL %i"%options.seekinterval
+            print >>hdrf,'CONSTTABLE_STORAGE(uint32_t) ' + options.name + '_SEEK_BITS[%i] = {\n%s\n};'%(len(seekbits),arrayformatter(seekbits))
+            print >>hdrf,'CONSTTABLE_STORAGE(int16_t) ' + options.name + '_SEEK_VALUES[%i] = {\n%s\n};'%(len(seekvalues),arrayformatter(seekvalues))
         print >>hdrf,'CONSTTABLE_STORAGE(unsigned char) ' + options.name + '_SOUNDDATA[] = {\n%s\n};'%arrayformatter(enc.data)
         print >>hdrf,"#endif /* " + options.name + "_H_ */"
@@ -0,0 +1,135 @@
+/*
+ * MetaOscil_lookup.cpp
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+/* Test for the table selection of MetaOscil, to be run on a desktop machine. The Oscil selected by the lookup table is compared to a plain
+ * linear walk over the cutoff frequencies (the first Oscil with a cutoff at or above the frequency, or the last one), for every integer
+ * frequency up to the sample rate, and for phase increments across the whole 32 bit range, including those right at, and next to the
+ * cutoffs. Each Oscil plays a table filled with its own rank, so the selected Oscil can be told from atIndex().
+ *
+ * Also checks that crossfading between two Oscil stays smooth, when the selection flips back and forth faster than the crossfade: the
+ * largest step between two samples must be no larger than for a single switch.
+ *
+ * Compile and run (from the Mozzi directory, see @ref hardware_host for the FixMath library) with:
+ *   g++ -O2 -I. -Iextras/host -I/path/to/FixMath/src extras/tests/MetaOscil/MetaOscil_lookup.cpp mozzi_fixmath.cpp -o metaoscil_lookup && ./metaoscil_lookup
+ */
+
+#include <utility>
+#include <math.h>
+#include "MozziHeadersOnly.h"
+#include "MetaOscil.h"
+
+#include <stdio.h>
+
+template<class META, class OSCIL, size_t... I>
+static void setOscils(META &meta, OSCIL *oscils, std::index_sequence<I...>) {
+	meta.setOscils(&oscils[I]...);
+}
+
+template<uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, byte N_OSCIL>
+static bool testLookup(const int (&cutoffs)[N_OSCIL]) {
+	static int8_t tables[N_OSCIL][NUM_TABLE_CELLS];
+	static Oscil<NUM_TABLE_CELLS, UPDATE_RATE> oscils[N_OSCIL];
+	static MetaOscil<NUM_TABLE_CELLS, UPDATE_RATE, N_OSCIL> meta;
+	for (byte i = 0; i < N_OSCIL; ++i) {
+		for (uint16_t j = 0; j < NUM_TABLE_CELLS; ++j) tables[i][j] = i;
+		oscils[i].setTable(tables[i]);
+	}
+	setOscils(meta, oscils, std::make_index_sequence<N_OSCIL>());
+	for (byte i = 0; i < N_OSCIL; ++i) meta.setCutoffFreq(cutoffs[i], i);
+
+	const uint32_t multiplier = (OSCIL_F_BITS_AS_MULTIPLIER * NUM_TABLE_CELLS) / UPDATE_RATE;
+	uint32_t errors = 0, checked = 0;
+
+	// setFreq(int): every integer frequency up to the sample rate
+	for (int freq = 0; freq <= UPDATE_RATE; ++freq) {
+		byte expected = 0;
+		while ((expected < N_OSCIL-1) && (cutoffs[expected] < freq)) ++expected;
+		meta.setFreq(freq, false);
+		++checked;
+		if (meta.atIndex(0) != expected) {
+			if (errors++ < 10) printf("  frequency %d: selected %d, expected %d\n", freq, meta.atIndex(0), expected);
+		}
+	}
+
+	// setPhaseInc(): increments across the whole range, with 256 steps per octave, and around each cutoff
+	auto checkIncrement = [&](uint32_t increment) {
+		byte expected = 0;
+		while ((expected < N_OSCIL-1) && ((uint32_t) cutoffs[expected] * multiplier < increment)) ++expected;
+		meta.setPhaseInc(increment);
+		++checked;
+		if (meta.atIndex(0) != expected) {
+			if (errors++ < 10) printf("  increment %lu: selected %d, expected %d\n", (unsigned long) increment, meta.atIndex(0), expected);
+		}
+	};
+	checkIncrement(0);
+	for (uint8_t bit = 0; bit < 32; ++bit) {
+		for (uint16_t step = 0; step < 256; ++step) {
+			checkIncrement((1UL << bit) + (bit >= 8 ? ((uint32_t) step << (bit - 8)) : (step & ((1UL << bit) - 1))));
+		}
+	}
+	checkIncrement(0xFFFFFFFFUL);
+	for (byte i = 0; i < N_OSCIL; ++i) {
+		const uint32_t cutoff_increment = (uint32_t) cutoffs[i] * multiplier;
+		for (int32_t d = -2; d <= 2; ++d) checkIncrement(cutoff_increment + d);
+	}
+
+	printf("MetaOscil<%u, %u, %u>: %lu selections: %s\n", NUM_TABLE_CELLS, UPDATE_RATE, N_OSCIL, (unsigned long) checked, errors ? "FAILED" : "ok");
+	return !errors;
+}
+
+// Largest step between two samples over 4096 samples at 130 Hz and 140 Hz (on both sides of the cutoff), switching every flip samples
+template<uint16_t CROSSFADE>
+static int maxStep(uint16_t flip) {
+	static int8_t tables[2][512];
+	for (uint16_t j = 0; j < 512; ++j) {
+		double saw = 0;
+		for (int h = 1; h <= 16; ++h) saw += sin(2 * M_PI * h * j / 512) / h;
+		tables[0][j] = lrint(65 * saw);  // bright below the cutoff
+		tables[1][j] = lrint(100 * sin(2 * M_PI * j / 512));  // plain sine above
+	}
+	Oscil<512, 32768> oscils[2] = { Oscil<512, 32768>(tables[0]), Oscil<512, 32768>(tables[1]) };
+	MetaOscil<512, 32768, 2, CROSSFADE> meta(&oscils[0], &oscils[1]);
+	meta.setCutoffFreqs(135, 32767);
+	meta.setPhase(0);
+	meta.setFreq(130);
+	int previous = meta.next(), max_step = 0;
+	for (uint16_t i = 1; i < 4096; ++i) {
+		if (!(i % flip)) meta.setFreq(((i / flip) & 1) ? 140 : 130);
+		const int sample = meta.next();
+		if (abs(sample - previous) > max_step) max_step = abs(sample - previous);
+		previous = sample;
+	}
+	return max_step;
+}
+
+static bool testCrossfade() {
+	const int single = maxStep<64>(2048), flipping = maxStep<64>(20), abrupt = maxStep<0>(20);
+	const bool ok = flipping <= single;
+	printf("MetaOscil crossfade: largest step %d for a single switch, %d switching every 20 samples (%d without crossfade): %s\n", single, flipping, abrupt, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main() {
+	bool ok = true;
+	// the cutoffs of examples/06.Synthesis/NonAlias_MetaOscil
+	const int example_cutoffs[16] = {90, 101, 122, 138, 154, 174, 210, 264, 327, 431, 546, 744, 1170, 1638, 2730, 8192};
+	ok &= testLookup<512, 16384>(example_cutoffs);
+	ok &= testLookup<512, 32768>(example_cutoffs);
+	ok &= testLookup<2048, 32768>(example_cutoffs);
+	// several cutoffs within one entry of the lookup table, some very low, and the last one above the sample rate
+	const int dense_cutoffs[8] = {1, 3, 4, 1000, 1001, 1002, 1100, 20000};
+	ok &= testLookup<256, 16384>(dense_cutoffs);
+	ok &= testLookup<8192, 32768>(dense_cutoffs);
+	const int single_cutoff[1] = {440};
+	ok &= testLookup<1024, 16384>(single_cutoff);
+	ok &= testCrossfade();
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+/*
+ * OscilDither_spurs.cpp
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+/* Measurement of the spurs of Oscil with, and without DITHER_PHASE, to be run on a desktop machine. A 256 and a 512 cell int16_t sine
+ * table are played at a few frequencies, which do not divide the sample rate evenly, with next() (at a fixed frequency, and with
+ * setFreq() every 512 samples), and with fill() in blocks of 32 and 128 samples. The largest spur (the largest bin of the spectrum,
+ * more than 8 bins away from the tone, relative to the tone) and the total noise are printed for each. The test fails, unless
+ * dithering lowers the largest spur of next(), and of fill() in blocks of 32 samples, by at least 8 dB, for all frequencies.
+ *
+ * Compile and run (from the Mozzi directory, see @ref hardware_host for the FixMath library) with:
+ *   g++ -O2 -I. -Iextras/host -I/path/to/FixMath/src extras/tests/OscilDither/OscilDither_spurs.cpp mozzi_fixmath.cpp -o oscildither_spurs && ./oscildither_spurs
+ */
+
+#include <math.h>
+#include "MozziHeadersOnly.h"
+#include "Oscil.h"
+
+#include <stdio.h>
+
+static const uint16_t RATE = 32768;
+static const int N = 16384;  // samples per measurement, i.e. FFT size
+
+struct Spurs {
+	double worst;  // dB, largest spur relative to the tone
+	double noise;  // dB, everything but the tone, relative to the tone
+};
+
+// Spectrum of x (Blackman-Harris window, radix 2 FFT), and its largest spur, and noise, outside of +-8 bins around the tone
+static Spurs measure(const double * x) {
+	static double re[N], im[N];
+	for (int i = 0; i < N; ++i) {
+		const double w = 2 * M_PI * i / N;
+		re[i] = x[i] * (0.35875 - 0.48829 * cos(w) + 0.14128 * cos(2 * w) - 0.01168 * cos(3 * w));
+		im[i] = 0;
+	}
+	for (int i = 1, j = 0; i < N; ++i) {
+		int bit = N >> 1;
+		for (; j & bit; bit >>= 1) j ^= bit;
+		j ^= bit;
+		if (i < j) {
+			double t = re[i]; re[i] = re[j]; re[j] = t;
+		}
+	}
+	for (int len = 2; len <= N; len <<= 1) {
+		const double a = -2 * M_PI / len;
+		for (int i = 0; i < N; i += len) {
+			for (int k = 0; k < len / 2; ++k) {
+				const double c = cos(a * k), s = sin(a * k);
+				double * r = re + i + k, * m = im + i + k;
+				const double vr = r[len / 2] * c - m[len / 2] * s, vi = r[len / 2] * s + m[len / 2] * c;
+				r[len / 2] = r[0] - vr; m[len / 2] = m[0] - vi;
+				r[0] += vr; m[0] += vi;
+			}
+		}
+	}
+	int peak = 1;
+	for (int k = 1; k < N / 2; ++k) {
+		if (hypot(re[k], im[k]) > hypot(re[peak], im[peak])) peak = k;
+	}
+	double tone = 0, spur = 0, noise = 0;
+	for (int k = 1; k < N / 2; ++k) {
+		const double power = re[k] * re[k] + im[k] * im[k];
+		if (abs(k - peak) <= 8) {
+			tone += power;
+		} else {
+			noise += power;
+			if (power > spur) spur = power;
+		}
+	}
+	Spurs result = { 10 * log10(spur / (re[peak] * re[peak] + im[peak] * im[peak])), 10 * log10(noise / tone) };
+	return result;
+}
+
+enum Mode { NEXT, NEXT_SETFREQ, FILL_32, FILL_128 };
+static const char * const mode_names[] = { "next()", "next(), setFreq() every 512", "fill(), blocks of 32", "fill(), blocks of 128" };
+
+template <uint16_t NUM_TABLE_CELLS, bool DITHER>
+static Spurs play(const int16_t * table, float freq, Mode mode) {
+	static double x[N];
+	static int16_t block[128];
+	Oscil<NUM_TABLE_CELLS, RATE, int16_t, INTERP_NONE, DITHER> osc(table);
+	osc.setPhase(0);
+	osc.setFreq(freq);
+	if (mode == FILL_32 || mode == FILL_128) {
+		const int n = (mode == FILL_32) ? 32 : 128;
+		for (int i = 0; i < N; i += n) {
+			osc.fill(block, n);
+			for (int j = 0; j < n; ++j) x[i + j] = block[j] / 32768.0;
+		}
+	} else {
+		for (int i = 0; i < N; ++i) {
+			if (mode == NEXT_SETFREQ && !(i % 512)) osc.setFreq(freq);
+			x[i] = osc.next() / 32768.0;
+		}
+	}
+	return measure(x);
+}
+
+template <uint16_t NUM_TABLE_CELLS>
+static bool testTable() {
+	static int16_t table[NUM_TABLE_CELLS];
+	for (uint16_t i = 0; i < NUM_TABLE_CELLS; ++i) table[i] = lrint(32767 * sin(2 * M_PI * i / NUM_TABLE_CELLS));
+	bool ok = true;
+	const float freqs[] = { 440.f, 1234.567f, 3001.7f };
+	for (float freq : freqs) {
+		const Spurs plain = play<NUM_TABLE_CELLS, false>(table, freq, NEXT);
+		printf("sin%u int16 %7.1f Hz, no dither: worst spur %6.1f dB, noise %6.1f dB\n", NUM_TABLE_CELLS, freq, plain.worst, plain.noise);
+		for (int mode = NEXT; mode <= FILL_128; ++mode) {
+			const Spurs dithered = play<NUM_TABLE_CELLS, true>(table, freq, (Mode) mode);
+			const bool required = (mode == NEXT || mode == FILL_32);
+			const bool good = !required || (dithered.worst <= plain.worst - 8);
+			ok &= good;
+			printf("  dither, %-28s worst spur %6.1f dB, noise %6.1f dB%s\n", mode_names[mode], dithered.worst, dithered.noise, good ? "" : "  FAILED");
+		}
+	}
+	return ok;
+}
+
+int main() {
+	bool ok = true;
+	ok &= testTable<256>();
+	ok &= testTable<512>();
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+/*
+ * SPSCFifo_stress.cpp
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+/* Stress test for SPSCFifo, to be run on a (multi core) desktop machine. A producer and a consumer thread hammer the FIFO as fast as
+ * they can, the producer alternating between single writes, and block writes via writeAddress()/advanceWrite(). Each item carries a
+ * sequence number, and a checksum of it, so lost, duplicated, reordered, or partially written items are all detected by the consumer.
+ *
+ * Compile and run (from the Mozzi directory) with:
+ *   g++ -O2 -std=c++11 -pthread -I. extras/tests/SPSCFifo/SPSCFifo_stress.cpp -o spscfifo_stress && ./spscfifo_stress
+ * Adding -fsanitize=thread is a good idea, too.
+ */
+
+#include "SPSCFifo.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+struct Item {
+	uint32_t seq;
+	uint32_t check;
+};
+
+static inline uint32_t checksum(uint32_t seq) { return ~(seq * 2654435761u); }
+
+template<uint16_t NUM_ITEMS>
+static bool stress(uint32_t num_transfers) {
+	static SPSCFifo<Item, NUM_ITEMS> fifo;
+	std::atomic<bool> ok(true);
+
+	std::thread producer([&]() {
+		uint32_t seq = 0;
+		while (seq < num_transfers && ok) {
+			if (seq & 0x100) {  // block writes, of varying length
+				uint16_t n = fifo.contiguousFreeSpace();
+				if (n > (seq & 0x1F) + 1) n = (seq & 0x1F) + 1;
+				if (n > num_transfers - seq) n = num_transfers - seq;
+				Item *dest = fifo.writeAddress();
+				for (uint16_t i = 0; i < n; ++i, ++seq) {
+					dest[i].seq = seq;
+					dest[i].check = checksum(seq);
+				}
+				fifo.advanceWrite(n);
+				if (!n) std::this_thread::yield();
+			} else if (!fifo.isFull()) {
+				fifo.write(Item{seq, checksum(seq)});
+				++seq;
+			} else {
+				std::this_thread::yield();  // don't hog the CPU, in case there are fewer cores than threads
+			}
+		}
+	});
+
+	std::thread consumer([&]() {
+		uint32_t expected = 0;
+		while (expected < num_transfers) {
+			if (fifo.isEmpty()) {
+				std::this_thread::yield();
+				continue;
+			}
+			Item item = fifo.read();
+			if (item.seq != expected || item.check != checksum(expected)) {
+				fprintf(stderr, "  mismatch: expected item %u, got %u (checksum %s)\n", expected, item.seq, (item.check == checksum(item.seq)) ? "ok" : "BAD");
+				ok = false;
+				break;
+			}
+			++expected;
+		}
+		if (ok && fifo.count() != num_transfers) {
+			fprintf(stderr, "  count() is %lu, expected %u\n", fifo.count(), num_transfers);
+			ok = false;
+		}
+	});
+
+	producer.join();
+	consumer.join();
+	printf("SPSCFifo<Item, %u>: %u items: %s\n", NUM_ITEMS, num_transfers, ok ? "ok" : "FAILED");
+	return ok.load();
+}
+
+int main(int argc, char **argv) {
+	uint32_t n = (argc > 1) ? (uint32_t) atol(argv[1]) : 20000000;
+	bool ok = stress<2>(n / 8);
+	ok &= stress<32>(n);
+	ok &= stress<256>(n);
+	ok &= stress<4096>(n);
+	return ok ? 0 : 1;
+}
@@ -102,7 +102,14 @@
 #define IS_ESP32() 0
 #endif
 
-#if !(IS_AVR() || IS_TEENSY3() || IS_TEENSY4() || IS_STM32MAPLE() || IS_STM32DUINO() || IS_ESP8266() || IS_SAMD21() || IS_ESP32() || IS_RP2040() || IS_MBED() || IS_RENESAS())
+// Desktop host (Linux, macOS), i.e. not an Arduino core at all. Used for offline rendering and profiling.
+#if (!defined(ARDUINO) && (defined(__linux__) || defined(__APPLE__)))
+#define IS_HOST() 1
+#else
+#define IS_HOST() 0
+#endif
+
+#if !(IS_AVR() || IS_TEENSY3() || IS_TEENSY4() || IS_STM32MAPLE() || IS_STM32DUINO() || IS_ESP8266() || IS_SAMD21() || IS_ESP32() || IS_RP2040() || IS_MBED() || IS_RENESAS() || IS_HOST())
 // TODO: add an exception for MOZZI_OUTPUT_EXTERNAL_CUSTOM
 #error Your hardware is not supported by Mozzi or not recognized. Edit hardware_defines.h to proceed.
 #endif
@@ -12,8 +12,15 @@
 #include <Arduino.h>
 
 #include "CircularBuffer.h"
+#if IS_RP2040() || IS_ESP32() || IS_HOST()
+#include "SPSCFifo.h"
+#include <atomic>
+#endif
 #include "mozzi_analog.h"
 #include "internal/mozzi_rand_p.h"
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED)
+#include "internal/mozzi_cycle_counter.h"
+#endif
 #include "AudioOutput.h"
 
 /** @brief Internal. Do not use function in this namespace in your sketch!
@@ -34,6 +41,14 @@ static void startSecondADCReadOnCurrentChannel();   // to be provided by platfor
 static uint8_t adc_count = 0;                       // needed below
 #endif
 
+// The output and input buffers are shared between the code rendering audio, and the (interrupt or other core) consuming it.
+// On dual core platforms, and on the host, where the two may run truly in parallel, a lock-free FIFO with proper memory ordering is used.
+#if IS_RP2040() || IS_ESP32() || IS_HOST()
+template<class ITEM_TYPE, uint16_t NUM_ITEMS = MOZZI_BUFFER_SIZE> using AudioFifo = SPSCFifo<ITEM_TYPE, NUM_ITEMS>;
+#else
+template<class ITEM_TYPE, uint16_t NUM_ITEMS = MOZZI_BUFFER_SIZE> using AudioFifo = CircularBuffer<ITEM_TYPE, NUM_ITEMS>;
+#endif
+
 // TODO: make this helper public?
 template<byte BITS_IN, byte BITS_OUT, typename T> constexpr T smartShift(T value) {
     return (BITS_IN > BITS_OUT) ? value >> (BITS_IN - BITS_OUT) : (BITS_IN < BITS_OUT) ? value << (BITS_OUT - BITS_IN) : value;
@@ -61,6 +76,8 @@ template<byte BITS_IN, byte BITS_OUT, typename T> constexpr T smartShift(T value
 #  include "MozziGuts_impl_MBED.hpp"
 #elif (IS_RENESAS())
 #  include "MozziGuts_impl_RENESAS.hpp"
+#elif (IS_HOST())
+#  include "MozziGuts_impl_HOST.hpp"
 #else
 #  error "Platform not (yet) supported. Check MozziGuts_impl_template.hpp and existing implementations for a blueprint for adding your favorite MCU."
 #endif
@@ -77,16 +94,90 @@ template<byte BITS_IN, byte BITS_OUT, typename T> constexpr T smartShift(T value
 #endif
 
 namespace MozziPrivate {
+////// BEGIN load meter /////
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED)
+/* Rendering time is summed up over windows of (at least) LOAD_METER_WINDOW samples. Only the result of the last complete window is kept,
+ * so the average follows changes in load, and the sum cannot overflow. */
+#define LOAD_METER_WINDOW 1024
+static uint32_t load_meter_start;
+static uint32_t load_meter_window_cycles = 0;
+static uint16_t load_meter_window_samples = 0;
+static uint32_t load_meter_average = 0;
+static uint32_t load_meter_peak = 0;
+static volatile uint32_t load_meter_underruns = 0;
+static volatile uint16_t load_meter_low_water = MOZZI_OUTPUT_BUFFER_SIZE;
+
+inline void loadMeterBegin() {
+  load_meter_start = mozziCycleCount();
+}
+
+inline void loadMeterEnd(uint16_t samples) {
+  uint32_t cycles = mozziCycleCount() - load_meter_start;
+  uint32_t per_sample = (samples > 1) ? cycles / samples : cycles;
+  if (per_sample > load_meter_peak) load_meter_peak = per_sample;
+  load_meter_window_cycles += cycles;
+  load_meter_window_samples += samples;
+  if (load_meter_window_samples >= LOAD_METER_WINDOW) {
+    load_meter_average = load_meter_window_cycles / load_meter_window_samples;
+    load_meter_window_cycles = 0;
+    load_meter_window_samples = 0;
+  }
+}
+
+// The underrun counter and low-water mark are updated by the output (typically an interrupt). Read until we get a consistent value.
+template<typename T> inline T loadMeterRead(volatile T &value) {
+  T ret;
+  do {
+    ret = value;
+  } while (ret != value);
+  return ret;
+}
+
+float mozziCpuLoad() { return (float) load_meter_average * MOZZI_AUDIO_RATE / mozziCycleCounterHz(); }
+uint32_t mozziAverageCycles() { return load_meter_average; }
+uint32_t mozziPeakCycles() { return load_meter_peak; }
+uint32_t mozziUnderruns() { return loadMeterRead(load_meter_underruns); }
+uint16_t mozziBufferLowWater() {
+#  if BYPASS_MOZZI_OUTPUT_BUFFER == true
+  return 0;
+#  else
+  return loadMeterRead(load_meter_low_water);
+#  endif
+}
+void mozziResetLoadMeter() {
+  load_meter_peak = 0;
+  noInterrupts();  // both are updated by the output, and may be wider than a single write
+  load_meter_underruns = 0;
+  load_meter_low_water = MOZZI_OUTPUT_BUFFER_SIZE;
+  interrupts();
+}
+#else
+inline void loadMeterBegin() {}
+inline void loadMeterEnd(uint16_t) {}
+#endif
+////// END load meter /////
+
 ////// BEGIN Output buffering /////
 #if BYPASS_MOZZI_OUTPUT_BUFFER == true
+#  if defined(MOZZI__SEPARATE_RENDER_TASK)
+// Written by the render core / task, but read by audioTicks() on any core. A 64 bit counter could be read half updated, so use a
+// single (atomic) word. Nothing is lost, as audioTicks() returns an unsigned long, anyway.
+std::atomic<unsigned long> samples_written_to_buffer(0);
+
+inline void bufferAudioOutput(const AudioOutput f) {
+  audioOutput(f);
+  samples_written_to_buffer.store(samples_written_to_buffer.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+#  else
 uint64_t samples_written_to_buffer = 0;
 
 inline void bufferAudioOutput(const AudioOutput f) {
   audioOutput(f);
   ++samples_written_to_buffer;
 }
+#  endif
 #else
-CircularBuffer<AudioOutput> output_buffer;  // fixed size 256
+AudioFifo<AudioOutput, MOZZI_OUTPUT_BUFFER_SIZE> output_buffer;
 #  define canBufferAudioOutput() (!output_buffer.isFull())
 #  define bufferAudioOutput(f) output_buffer.write(f)
 static void CACHED_FUNCTION_ATTR defaultAudioOutput() {
@@ -96,6 +187,16 @@ static void CACHED_FUNCTION_ATTR defaultAudioOutput() {
   adc_count = 0;
   startSecondADCReadOnCurrentChannel();  // the current channel is the AUDIO_INPUT pin
 #  endif
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED)
+  uint16_t fill = output_buffer.available();
+  if (fill < load_meter_low_water) load_meter_low_water = fill;
+#endif
+  if (output_buffer.isEmpty()) {  // underrun: rendering did not keep up. Keep outputting the previous sample, rather than reading past the end of the buffer.
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED)
+    ++load_meter_underruns;
+#endif
+    return;
+  }
   audioOutput(output_buffer.read());
 }
 #endif  // #if (AUDIO_INPUT_MODE == AUDIO_INPUT_LEGACY)
@@ -150,7 +251,7 @@ uint16_t getAudioInput() { return audio_input; }
 
 #if MOZZI_IS(MOZZI__LEGACY_AUDIO_INPUT_IMPL, 1)
 // ring buffer for audio input
-CircularBuffer<uint16_t> input_buffer; // fixed size 256
+AudioFifo<uint16_t> input_buffer; // fixed size 256
 #define audioInputAvailable() (!input_buffer.isEmpty())
 #define readAudioInput() (input_buffer.read())
 /** NOTE: Triggered at MOZZI_AUDIO_RATE via defaultAudioOutput(). In addition to the AUDIO_INPUT_PIN, at most one reading is taken for mozziAnalogRead().  */
@@ -214,24 +315,221 @@ uint16_t mozziAnalogRead(uint8_t pin) {
 static uint16_t update_control_timeout;
 static uint16_t update_control_counter;
 
+#if (MOZZI_CONTROL_TASKS > 0)
+/* Additional control tasks, each running every (mask + 1) samples, i.e. when ((control_task_tick + phase) & mask) == 0.
+ * Phases are picked such that tasks (and updateControl()) coincide as rarely as possible, see scheduleControlTasks(). */
+struct ControlTask {
+  void (*callback)();
+  uint16_t mask;
+  uint16_t phase;
+};
+static ControlTask control_tasks[MOZZI_CONTROL_TASKS];
+static uint8_t num_control_tasks = 0;
+static uint16_t control_task_tick = 0;
+
+/* Two tasks with power of two periods a and b run in the same sample, iff their phases are equal modulo min(a, b) (their greatest common divisor).
+ * For each task, in order of registration, pick the smallest phase that collides with the fewest of the tasks before it. Only needs to be done once,
+ * so we don't try to be clever about it. */
+inline void scheduleControlTasks() {
+  // updateControl() runs at multiples of (update_control_timeout + 1). The largest power of two dividing that is its "period" for our purposes.
+  uint16_t control_period = update_control_timeout + 1;
+  control_period = control_period & -control_period;
+  for (uint8_t i = 0; i < num_control_tasks; ++i) {
+    uint16_t period = control_tasks[i].mask + 1;
+    uint16_t best_phase = 0;
+    uint8_t best_collisions = 255;
+    for (uint32_t phase = 0; phase < period; ++phase) {
+      uint8_t collisions = ((phase & (min(period, control_period) - 1)) == 0);
+      for (uint8_t j = 0; j < i; ++j) {
+        uint16_t common = min(control_tasks[i].mask, control_tasks[j].mask);
+        if (((phase - control_tasks[j].phase) & common) == 0) ++collisions;
+      }
+      if (collisions < best_collisions) {
+        best_collisions = collisions;
+        best_phase = phase;
+        if (!collisions) break;
+      }
+    }
+    control_tasks[i].phase = best_phase;
+  }
+}
+
+bool addControlTask(void (*callback)(), uint16_t audio_rate_divisor) {
+  if ((num_control_tasks >= MOZZI_CONTROL_TASKS) || !audio_rate_divisor || (audio_rate_divisor & (audio_rate_divisor - 1))) return false;
+  control_tasks[num_control_tasks].callback = callback;
+  control_tasks[num_control_tasks].mask = audio_rate_divisor - 1;
+  ++num_control_tasks;
+  scheduleControlTasks();
+  return true;
+}
+
+/* Run all tasks due in the current sample */
+inline void runControlTasks() {
+  for (uint8_t i = 0; i < num_control_tasks; ++i) {
+    if (((control_task_tick + control_tasks[i].phase) & control_tasks[i].mask) == 0) control_tasks[i].callback();
+  }
+}
+
+/* Number of samples until the next task is due (at least 1, as tasks due in the current sample are assumed to have been run) */
+inline uint16_t samplesToNextControlTask(uint16_t max_n) {
+  for (uint8_t i = 0; i < num_control_tasks; ++i) {
+    uint16_t n = (control_tasks[i].mask + 1) - ((control_task_tick + control_tasks[i].phase) & control_tasks[i].mask);
+    if (n < max_n) max_n = n;
+  }
+  return max_n;
+}
+#else
+inline void runControlTasks() {}
+inline uint16_t samplesToNextControlTask(uint16_t max_n) { return max_n; }
+#endif
+
+#if (MOZZI_EVENT_QUEUE_SIZE > 0)
+/* Pending events, sorted by tick. event_queue_start is the index of the earliest one, the others follow, wrapping around at the end of the array. */
+static MozziEvent event_queue[MOZZI_EVENT_QUEUE_SIZE];
+static uint8_t event_queue_start = 0;
+static uint8_t event_queue_count = 0;
+static uint32_t render_ticks = 0;  // index of the next sample to render
+
+inline uint8_t eventQueueIndex(uint8_t pos) {
+  uint16_t index = event_queue_start + pos;
+  return (index >= MOZZI_EVENT_QUEUE_SIZE) ? index - MOZZI_EVENT_QUEUE_SIZE : index;
+}
+
+bool scheduleEvent(uint32_t tick, uint8_t type, uint8_t param, int16_t value) {
+  if (event_queue_count >= MOZZI_EVENT_QUEUE_SIZE) return false;
+  // Insert behind all events due at the same time, or earlier. Typically, events are scheduled in order, so search from the back.
+  uint8_t pos = event_queue_count;
+  while (pos && ((int32_t) (tick - event_queue[eventQueueIndex(pos - 1)].tick) < 0)) {
+    event_queue[eventQueueIndex(pos)] = event_queue[eventQueueIndex(pos - 1)];
+    --pos;
+  }
+  MozziEvent &event = event_queue[eventQueueIndex(pos)];
+  event.tick = tick;
+  event.type = type;
+  event.param = param;
+  event.value = value;
+  ++event_queue_count;
+  return true;
+}
+
+/* Handle all events due for the sample at render_ticks (or earlier) */
+inline void handleDueEvents() {
+  while (event_queue_count && ((int32_t) (event_queue[event_queue_start].tick - render_ticks) <= 0)) {
+    MozziEvent event = event_queue[event_queue_start];  // copy, as the handler may schedule further events
+    event_queue_start = eventQueueIndex(1);
+    --event_queue_count;
+    handleAudioEvent(event);
+  }
+}
+
+/* Number of samples until the next event is due (at least 1, as events due in the current sample are assumed to have been handled) */
+inline uint16_t samplesToNextEvent(uint16_t max_n) {
+  if (event_queue_count) {
+    uint32_t n = event_queue[event_queue_start].tick - render_ticks;
+    if (n < max_n) max_n = n;
+  }
+  return max_n;
+}
+#else
+inline void handleDueEvents() {}
+inline uint16_t samplesToNextEvent(uint16_t max_n) { return max_n; }
+#endif
+
+inline void updateControlWithAutoADC() {
+  updateControl();
+#if MOZZI_IS(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_STANDARD)
+  adcStartReadCycle();
+#endif
+}
+
+#if (MOZZI_AUDIO_BLOCK_SIZE > 1)
+/* In block mode, update_control_counter holds the number of samples left until the next call to updateControl().
+ * Renders up to max_n samples to out, stopping at the next control rate boundary (or the next control task). Returns the number of samples rendered. */
+inline uint16_t renderAudioBlock(AudioOutput* out, uint16_t max_n) {
+  if (!update_control_counter) {
+    update_control_counter = update_control_timeout + 1;
+    updateControlWithAutoADC();
+  }
+  runControlTasks();
+  handleDueEvents();
+  uint16_t n = (max_n < update_control_counter) ? max_n : update_control_counter;
+  n = samplesToNextControlTask(n);
+  n = samplesToNextEvent(n);
+  updateAudioBlock(out, n);
+  update_control_counter -= n;
+#if (MOZZI_CONTROL_TASKS > 0)
+  control_task_tick += n;
+#endif
+#if (MOZZI_EVENT_QUEUE_SIZE > 0)
+  render_ticks += n;
+#endif
+  return n;
+}
+
+void audioHook()
+{
+#  if (BYPASS_MOZZI_OUTPUT_BUFFER != true)
+  static_assert(MOZZI_AUDIO_BLOCK_SIZE <= MOZZI_OUTPUT_BUFFER_SIZE, "MOZZI_AUDIO_BLOCK_SIZE must not be larger than MOZZI_OUTPUT_BUFFER_SIZE");
+  if (output_buffer.freeSpace() >= MOZZI_AUDIO_BLOCK_SIZE) {
+    uint16_t n = output_buffer.contiguousFreeSpace();
+    if (n > MOZZI_AUDIO_BLOCK_SIZE) n = MOZZI_AUDIO_BLOCK_SIZE;
+    loadMeterBegin();
+    n = renderAudioBlock(output_buffer.writeAddress(), n);
+    loadMeterEnd(n);
+    output_buffer.advanceWrite(n);
+#    if defined(LOOP_YIELD)
+    LOOP_YIELD
+#    endif
+  }
+#  else
+  // Without an output buffer of our own, render into a scratch block, and hand that out one sample at a time.
+  static AudioOutput block[MOZZI_AUDIO_BLOCK_SIZE];
+  static uint16_t block_pos = 0;
+  static uint16_t block_len = 0;
+  if ((block_pos == block_len) && canBufferAudioOutput()) {
+    loadMeterBegin();
+    block_len = renderAudioBlock(block, MOZZI_AUDIO_BLOCK_SIZE);
+    loadMeterEnd(block_len);
+    block_pos = 0;
+#    if defined(LOOP_YIELD)
+    LOOP_YIELD
+#    endif
+  }
+  while ((block_pos < block_len) && canBufferAudioOutput()) {
+    bufferAudioOutput(block[block_pos++]);
+  }
+#  endif
+#  if defined(AUDIO_HOOK_HOOK)
+    AUDIO_HOOK_HOOK
+#  endif
+}
+#else
 inline void advanceControlLoop() {
   if (!update_control_counter) {
     update_control_counter = update_control_timeout;
-    updateControl();
-#if MOZZI_IS(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_STANDARD)
-    adcStartReadCycle();
-#endif
+    updateControlWithAutoADC();
   } else {
     --update_control_counter;
   }
+#if (MOZZI_CONTROL_TASKS > 0)
+  runControlTasks();
+  ++control_task_tick;
+#endif
 }
 
 void audioHook() // 2us on AVR excluding updateAudio()
 {
 // setPin13High();
   if (canBufferAudioOutput()) {
+    loadMeterBegin();
     advanceControlLoop();
-    bufferAudioOutput(updateAudio());
+#if (MOZZI_EVENT_QUEUE_SIZE > 0)
+    handleDueEvents();
+    ++render_ticks;
+#endif
+    AudioOutput out = updateAudio();
+    loadMeterEnd(1);
+    bufferAudioOutput(out);
 
 #if defined(LOOP_YIELD)
     LOOP_YIELD
@@ -247,6 +545,7 @@ void audioHook() // 2us on AVR excluding updateAudio()
 #endif
   // setPin13Low();
 }
+#endif
 
 // NOTE: This function counts the ticks of audio _output_, corresponding to real time elapsed.
 // It does _not_ provide the count of the current audio frame to be generated by updateAudio(). These two things will differ, slightly,
@@ -258,6 +557,8 @@ unsigned long audioTicks() {
   return output_buffer.count();
 #elif defined(AUDIOTICK_ADJUSTMENT)
   return samples_written_to_buffer - (AUDIOTICK_ADJUSTMENT);
+#elif defined(MOZZI__SEPARATE_RENDER_TASK)
+  return samples_written_to_buffer.load(std::memory_order_relaxed);
 #else
   return samples_written_to_buffer;
 #endif
@@ -275,6 +576,12 @@ void startMozzi(int control_rate_hz) {
 #endif
   // delay(200); // so AutoRange doesn't read 0 to start with
   update_control_timeout = MOZZI_AUDIO_RATE / control_rate_hz - 1;
+#if (MOZZI_CONTROL_TASKS > 0)
+  scheduleControlTasks();  // now that we know the control rate
+#endif
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED)
+  mozziCycleCounterInit();
+#endif
   startAudio();
 }
 
@@ -291,6 +598,7 @@ uint32_t MozziRandPrivate::z=521288629;
 #undef AUDIO_HOOK_HOOK
 #undef AUDIOTICK_ADJUSTMENT
 #undef MOZZI__LEGACY_AUDIO_INPUT_IMPL
+#undef LOAD_METER_WINDOW
 
 // "export" publicly accessible functions defined in this file
 // NOTE: unfortunately, we cannot just write "using MozziPrivate::mozziMicros()", etc. as that would conflict with, rather than define mozziMicros().
@@ -301,6 +609,12 @@ unsigned long mozziMicros() { return MozziPrivate::mozziMicros(); };
 unsigned long audioTicks() { return MozziPrivate::audioTicks(); };
 void startMozzi(int control_rate_hz) { MozziPrivate::startMozzi(control_rate_hz); };
 void stopMozzi() { MozziPrivate::stopMozzi(); };
+#if (MOZZI_CONTROL_TASKS > 0)
+bool addControlTask(void (*callback)(), uint16_t audio_rate_divisor) { return MozziPrivate::addControlTask(callback, audio_rate_divisor); };
+#endif
+#if (MOZZI_EVENT_QUEUE_SIZE > 0)
+bool scheduleEvent(uint32_t tick, uint8_t type, uint8_t param, int16_t value) { return MozziPrivate::scheduleEvent(tick, type, param, value); };
+#endif
 template<byte RES> uint16_t mozziAnalogRead(uint8_t pin) { return MozziPrivate::smartShift<MOZZI__INTERNAL_ANALOG_READ_RESOLUTION, RES>(MozziPrivate::mozziAnalogRead(pin));};
 #if !MOZZI_IS(MOZZI_AUDIO_INPUT, MOZZI_AUDIO_INPUT_NONE)
 template<byte RES> uint16_t getAudioInput() { return MozziPrivate::smartShift<MOZZI__INTERNAL_ANALOG_READ_RESOLUTION, RES>(MozziPrivate::getAudioInput()); };
@@ -310,7 +624,19 @@ void setupMozziADC(int8_t speed) { MozziPrivate::setupMozziADC(speed); };
 void setupFastAnalogRead(int8_t speed) { MozziPrivate::setupFastAnalogRead(speed); };
 uint8_t adcPinToChannelNum(uint8_t pin) { return MozziPrivate::adcPinToChannelNum(pin); };
 #endif
+#if defined(MOZZI__SEPARATE_RENDER_TASK)
+void audioHook() {};  // audio is rendered by a separate core or task, see platform implementation
+#else
 void audioHook() { MozziPrivate::audioHook(); };
+#endif
+#if MOZZI_IS(MOZZI_LOAD_METER, MOZZI_LOAD_METER_ENABLED)
+float mozziCpuLoad() { return MozziPrivate::mozziCpuLoad(); };
+uint32_t mozziAverageCycles() { return MozziPrivate::mozziAverageCycles(); };
+uint32_t mozziPeakCycles() { return MozziPrivate::mozziPeakCycles(); };
+uint32_t mozziUnderruns() { return MozziPrivate::mozziUnderruns(); };
+uint16_t mozziBufferLowWater() { return MozziPrivate::mozziBufferLowWater(); };
+void mozziResetLoadMeter() { MozziPrivate::mozziResetLoadMeter(); };
+#endif
 
 // This is not strictly needed, but we want it to throw an error, if users have audioOutput() in their sketch without external output configured
 #if !MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_TIMED, MOZZI_OUTPUT_EXTERNAL_CUSTOM)
@@ -40,23 +40,98 @@ void setupFastAnalogRead(int8_t speed) {
 #if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_INTERNAL_DAC) || MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_I2S_DAC) || MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PDM_VIA_I2S)
 } // namespace MozziPrivate
 #  include <driver/i2s.h>   // for I2S-based output modes, including - technically - internal DAC
+#  if (MOZZI_ESP32_RENDER_TASK_CORE >= 0)
+#    include <atomic>
+#  endif
 namespace MozziPrivate {
 const i2s_port_t i2s_num = MOZZI_I2S_PORT;
+#  define ESP32_DMA_BUF_COUNT 8
+#  define ESP32_DMA_BUF_LEN 128   // in frames of 4 bytes (16 bits, 2 channels)
 
-// On ESP32 we cannot test wether the DMA buffer has room. Instead, we have to use a one-sample mini buffer. In each iteration we
-// _try_ to write that sample to the DMA buffer, and if successful, we can buffer the next sample. Somewhat cumbersome, but works.
-// TODO: Should ESP32 gain an implemenation of i2s_available(), we should switch to using that, instead.
-static bool _esp32_can_buffer_next = true;
 #  if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_INTERNAL_DAC)
-static uint16_t _esp32_prev_sample[2];
-#    define ESP_SAMPLE_SIZE (2*sizeof(uint16_t))
+typedef uint16_t esp32_sample_t;
+#    define ESP_SAMPLE_ELEMS 2
 #  elif MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_I2S_DAC)
-static int16_t _esp32_prev_sample[2];
-#    define ESP_SAMPLE_SIZE (2*sizeof(int16_t))
+typedef int16_t esp32_sample_t;
+#    define ESP_SAMPLE_ELEMS 2
 #  elif MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PDM_VIA_I2S)
-static uint32_t _esp32_prev_sample[PDM_RESOLUTION];
-#    define ESP_SAMPLE_SIZE (PDM_RESOLUTION*sizeof(uint32_t))
+typedef uint32_t esp32_sample_t;
+#    define ESP_SAMPLE_ELEMS MOZZI_PDM_RESOLUTION
 #  endif
+#  define ESP_SAMPLE_SIZE (ESP_SAMPLE_ELEMS*sizeof(esp32_sample_t))
+
+/** Convert one sample to the format expected by the I2S peripheral. */
+inline void esp32_encodeSample(const AudioOutput f, esp32_sample_t *dest) {
+#  if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_INTERNAL_DAC)
+  dest[0] = (f.l() + MOZZI_AUDIO_BIAS) << 8;
+#    if (MOZZI_AUDIO_CHANNELS > 1)
+  dest[1] = (f.r() + MOZZI_AUDIO_BIAS) << 8;
+#    else
+  // For simplicity of code, even in mono, we're writing stereo samples
+  dest[1] = dest[0];
+#    endif
+#  elif MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PDM_VIA_I2S)
+  for (uint8_t i=0; i<MOZZI_PDM_RESOLUTION; ++i) {
+    dest[i] = pdmCode32(f.l() + MOZZI_AUDIO_BIAS);
+  }
+#  else
+  // PT8211 takes signed samples
+  dest[0] = f.l();
+  dest[1] = f.r();
+#  endif
+}
+
+static void stopI2SOutput() {
+  i2s_stop(i2s_num);
+  i2s_driver_uninstall(i2s_num);  // so startMozzi() can install it, again
+}
+
+#  if (MOZZI_ESP32_RENDER_TASK_CORE >= 0)
+/** Implementation notes:
+ *  - A dedicated task, pinned to MOZZI_ESP32_RENDER_TASK_CORE, calls audioHook() in a loop. audioHook() in loop() does nothing.
+ *  - Samples are collected in a block the size of exactly one DMA buffer, which is then handed to the driver with a single, blocking, i2s_write().
+ *    While all DMA buffers are full, the render task sleeps inside i2s_write(), leaving the core to loop(), and other tasks.
+ *  - To stop, the task finishes the block it is rendering, and stops the I2S driver, itself. This way, stopMozzi() also works from
+ *    updateControl(), which runs inside the task (it cannot wait for its own task to exit, then).
+ */
+#    define ESP32_SAMPLES_PER_DMA_BUF (ESP32_DMA_BUF_LEN * 4 / ESP_SAMPLE_SIZE)
+static esp32_sample_t _esp32_block[ESP32_SAMPLES_PER_DMA_BUF * ESP_SAMPLE_ELEMS];
+static uint16_t _esp32_block_pos = 0;
+
+inline bool canBufferAudioOutput() {
+  return true;  // audioOutput() blocks, while the DMA buffers are full
+}
+
+inline void audioOutput(const AudioOutput f) {
+  esp32_encodeSample(f, &_esp32_block[_esp32_block_pos * ESP_SAMPLE_ELEMS]);
+  if (++_esp32_block_pos >= ESP32_SAMPLES_PER_DMA_BUF) {
+    size_t bytes_written;
+    i2s_write(i2s_num, _esp32_block, sizeof(_esp32_block), &bytes_written, portMAX_DELAY);
+    _esp32_block_pos = 0;
+  }
+}
+
+void audioHook();
+static TaskHandle_t _esp32_render_task = nullptr;
+static std::atomic<bool> _esp32_render_run(false);     // cleared by stopMozzi() to ask the task to exit
+static std::atomic<bool> _esp32_render_exited(false);  // set by the task, once it will not touch the output, any more
+
+static void esp32RenderTask(void *) {
+  // Exit at a block boundary, only, i.e. never in the middle of updateAudio(), or of i2s_write()
+  while (_esp32_render_run.load(std::memory_order_acquire) || _esp32_block_pos) {
+    audioHook();
+  }
+  stopI2SOutput();
+  _esp32_render_exited.store(true, std::memory_order_release);
+  vTaskDelete(nullptr);
+}
+#  else
+// On ESP32 we cannot test wether the DMA buffer has room. Instead, we have to use a one-sample mini buffer. In each iteration we
+// _try_ to write that sample to the DMA buffer, and if successful, we can buffer the next sample. Somewhat cumbersome, but works.
+// TODO: Should ESP32 gain an implemenation of i2s_available(), we should switch to using that, instead.
+static bool _esp32_can_buffer_next = true;
+static esp32_sample_t _esp32_prev_sample[ESP_SAMPLE_ELEMS];
+static bool _esp32_output_running = false;  // no writes to the I2S driver, unless installed
 
 inline bool esp32_tryWriteSample() {
   size_t bytes_written;
@@ -65,31 +140,17 @@ inline bool esp32_tryWriteSample() {
 }
 
 inline bool canBufferAudioOutput() {
+  if (!_esp32_output_running) return false;
   if (_esp32_can_buffer_next) return true;
   _esp32_can_buffer_next = esp32_tryWriteSample();
   return _esp32_can_buffer_next;
 }
 
 inline void audioOutput(const AudioOutput f) {
-#  if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_INTERNAL_DAC)
-  _esp32_prev_sample[0] = (f.l() + MOZZI_AUDIO_BIAS) << 8;
-#    if (MOZZI_AUDIO_CHANNELS > 1)
-  _esp32_prev_sample[1] = (f.r() + MOZZI_AUDIO_BIAS) << 8;
-#    else
-  // For simplicity of code, even in mono, we're writing stereo samples
-  _esp32_prev_sample[1] = _esp32_prev_sample[0];
-#    endif
-#  elif MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PDM_VIA_I2S)
-  for (uint8_t i=0; i<MOZZI_PDM_RESOLUTION; ++i) {
-    _esp32_prev_sample[i] = pdmCode32(f.l() + MOZZI_AUDIO_BIAS);
-  }
-#  else
-  // PT8211 takes signed samples
-  _esp32_prev_sample[0] = f.l();
-  _esp32_prev_sample[1] = f.r();
-#  endif
+  esp32_encodeSample(f, _esp32_prev_sample);
   _esp32_can_buffer_next = esp32_tryWriteSample();
 }
+#  endif
 #endif
 
 #if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_TIMED)
@@ -98,6 +159,8 @@ inline void audioOutput(const AudioOutput f) {
 #  include <driver/timer.h>
 namespace MozziPrivate {
 
+static intr_handle_t _esp32_timer_handle;
+
 void CACHED_FUNCTION_ATTR timer0_audio_output_isr(void *) {
   TIMERG0.int_clr_timers.t0 = 1;
   TIMERG0.hw_timer[0].config.alarm_en = 1;
@@ -107,7 +170,6 @@ void CACHED_FUNCTION_ATTR timer0_audio_output_isr(void *) {
 
 static void startAudio() {
 #if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_TIMED)  // for external audio output, set up a timer running a audio rate
-  static intr_handle_t s_timer_handle;
   const int div = 2;
   timer_config_t config = {
     .alarm_en = (timer_alarm_t)true,
@@ -122,10 +184,22 @@ static void startAudio() {
   timer_set_counter_value(TIMER_GROUP_0, TIMER_0, 0);
   timer_set_alarm_value(TIMER_GROUP_0, TIMER_0, 80000000UL / MOZZI_AUDIO_RATE / div);
   timer_enable_intr(TIMER_GROUP_0, TIMER_0);
-  timer_isr_register(TIMER_GROUP_0, TIMER_0, &timer0_audio_output_isr, nullptr, 0, &s_timer_handle);
+  timer_isr_register(TIMER_GROUP_0, TIMER_0, &timer0_audio_output_isr, nullptr, 0, &_esp32_timer_handle);
   timer_start(TIMER_GROUP_0, TIMER_0);
 
 #elif !MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_CUSTOM)
+#  if (MOZZI_ESP32_RENDER_TASK_CORE >= 0)
+  if (_esp32_render_task) {  // the task of a previous run is (or was) on its way out
+    if (!_esp32_render_exited.load(std::memory_order_acquire) && (xTaskGetCurrentTaskHandle() == _esp32_render_task)) {
+      _esp32_render_run.store(true, std::memory_order_release);  // stopped and restarted from updateControl(): just keep running
+      return;
+    }
+    while (!_esp32_render_exited.load(std::memory_order_acquire)) {
+      vTaskDelay(1);
+    }
+    _esp32_render_task = nullptr;
+  }
+#  endif
   static const i2s_config_t i2s_config = {
 #  if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_I2S_DAC) || MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PDM_VIA_I2S)
     .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX),
@@ -137,8 +211,8 @@ static void startAudio() {
     .channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,  // always use stereo output. mono seems to be buggy, and the overhead is insignifcant on the ESP32
     .communication_format = (i2s_comm_format_t)(I2S_COMM_FORMAT_I2S | I2S_COMM_FORMAT_I2S_LSB),  // this appears to be the correct setting for internal DAC and PT8211, but not for other dacs
     .intr_alloc_flags = 0, // default interrupt priority
-    .dma_buf_count = 8,    // 8*128 bytes of buffer corresponds to 256 samples (2 channels, see above, 2 bytes per sample per channel)
-    .dma_buf_len = 128,
+    .dma_buf_count = ESP32_DMA_BUF_COUNT,
+    .dma_buf_len = ESP32_DMA_BUF_LEN,
     .use_apll = false
   };
 
@@ -157,11 +231,40 @@ static void startAudio() {
 #  endif
   i2s_zero_dma_buffer((i2s_port_t)i2s_num);
 
+#  if (MOZZI_ESP32_RENDER_TASK_CORE >= 0)
+  _esp32_render_run.store(true, std::memory_order_relaxed);
+  _esp32_render_exited.store(false, std::memory_order_relaxed);
+  xTaskCreatePinnedToCore(esp32RenderTask, "mozzi_render", MOZZI_ESP32_RENDER_TASK_STACK_SIZE, nullptr, MOZZI_ESP32_RENDER_TASK_PRIORITY, &_esp32_render_task,
+                          (MOZZI_ESP32_RENDER_TASK_CORE < portNUM_PROCESSORS) ? MOZZI_ESP32_RENDER_TASK_CORE : 0);
+#  else
+  _esp32_can_buffer_next = true;
+  _esp32_output_running = true;
+#  endif
 #endif
 }
 
 void stopMozzi() {
-  // TODO: implement me
+#if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_TIMED)
+  timer_pause(TIMER_GROUP_0, TIMER_0);
+  timer_disable_intr(TIMER_GROUP_0, TIMER_0);
+  esp_intr_free(_esp32_timer_handle);
+#elif !MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_CUSTOM)
+#  if (MOZZI_ESP32_RENDER_TASK_CORE >= 0)
+  if (_esp32_render_task) {
+    _esp32_render_run.store(false, std::memory_order_release);  // the task stops the output on its way out
+    if (xTaskGetCurrentTaskHandle() == _esp32_render_task) return;  // called from updateControl(): cannot wait for ourselves
+    while (!_esp32_render_exited.load(std::memory_order_acquire)) {
+      vTaskDelay(1);  // at most one DMA buffer to go
+    }
+    _esp32_render_task = nullptr;
+  }
+#  else
+  if (_esp32_output_running) {
+    _esp32_output_running = false;  // first, so audioHook() will not write to the uninstalled driver
+    stopI2SOutput();
+  }
+#  endif
+#endif
 }
 //// END AUDIO OUTPUT code ///////
 
@@ -174,5 +277,9 @@ void MozziRandPrivate::autoSeed() {
 //// END Random seeding ////////
 
 #undef ESP_SAMPLE_SIZE    // only used inside this file
+#undef ESP_SAMPLE_ELEMS
+#undef ESP32_DMA_BUF_COUNT
+#undef ESP32_DMA_BUF_LEN
+#undef ESP32_SAMPLES_PER_DMA_BUF
 
 } // namespace MozziPrivate
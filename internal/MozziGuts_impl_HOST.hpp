@@ -0,0 +1,167 @@
+/*
+ * MozziGuts_impl_HOST.hpp
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+*/
+
+#if !(IS_HOST())
+#  error "Wrong implementation included for this platform"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+namespace MozziPrivate {
+
+////// BEGIN analog input code ////////
+// Not available on the host. mozziAnalogRead() relays to analogRead(), which returns 0.
+////// END analog input code ////////
+
+////// BEGIN audio output code //////
+/** Implementation notes:
+ *  - There is no timer on the host. Rather, the output buffer is drained by audioHook() itself (see AUDIO_HOOK_HOOK), whenever it is too full to render the
+ *    next sample (or block, see MOZZI_AUDIO_BLOCK_SIZE).
+ *    The fill level of the buffer thus stays at the same point as on real hardware running at full load, and audioTicks() behaves the same.
+ *  - Samples are counted as they leave the buffer. Once the requested number of samples has been output, the render is finished, and the program exits.
+ */
+static FILE *host_out_file = nullptr;
+static bool host_out_is_wav = false;
+static uint64_t host_samples_to_render = 0;
+static uint64_t host_samples_rendered = 0;
+static uint64_t host_samples_clipped = 0;
+static struct timespec host_render_start;
+
+static void hostFinishRender();
+
+inline void hostCountRenderedSample() {
+  if (++host_samples_rendered >= host_samples_to_render) hostFinishRender();
+}
+
+#if !BYPASS_MOZZI_OUTPUT_BUFFER
+#  define AUDIO_HOOK_HOOK { while (output_buffer.freeSpace() < MOZZI_AUDIO_BLOCK_SIZE) { defaultAudioOutput(); hostCountRenderedSample(); } }
+#endif
+
+static void hostWriteLE(uint32_t value, uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; ++i) {
+    fputc((value >> (8*i)) & 0xFF, host_out_file);
+  }
+}
+
+static void hostWriteWavHeader(uint32_t data_bytes) {
+  fwrite("RIFF", 1, 4, host_out_file);
+  hostWriteLE(36 + data_bytes, 4);
+  fwrite("WAVEfmt ", 1, 8, host_out_file);
+  hostWriteLE(16, 4);                                // size of fmt chunk
+  hostWriteLE(1, 2);                                 // PCM
+  hostWriteLE(MOZZI_AUDIO_CHANNELS, 2);
+  hostWriteLE(MOZZI_AUDIO_RATE, 4);
+  hostWriteLE(MOZZI_AUDIO_RATE * MOZZI_AUDIO_CHANNELS * 2, 4);  // bytes per second
+  hostWriteLE(MOZZI_AUDIO_CHANNELS * 2, 2);          // bytes per frame
+  hostWriteLE(16, 2);                                // bits per sample
+  fwrite("data", 1, 4, host_out_file);
+  hostWriteLE(data_bytes, 4);
+}
+
+#if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_FILE)
+inline void hostWriteChannel(AudioOutputStorage_t value) {
+  int32_t v = smartShift<MOZZI_AUDIO_BITS, 16>((int32_t) value);
+  if (v > 32767) { v = 32767; ++host_samples_clipped; }
+  else if (v < -32768) { v = -32768; ++host_samples_clipped; }
+  hostWriteLE((uint16_t) v, 2);
+}
+
+inline void audioOutput(const AudioOutput f) {
+  hostWriteChannel(f.l());
+#  if (MOZZI_AUDIO_CHANNELS > 1)
+  hostWriteChannel(f.r());
+#  endif
+}
+#endif
+
+static void hostSetupRender(int argc, char **argv) {
+  const char *filename = (argc > 1) ? argv[1] : "-";
+  double seconds = (argc > 2) ? atof(argv[2]) : MOZZI_HOST_RENDER_SECONDS;
+  host_samples_to_render = (uint64_t) (seconds * MOZZI_AUDIO_RATE);
+
+#if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_FILE)
+  if (!strcmp(filename, "-")) {
+    host_out_file = stdout;
+  } else {
+    host_out_file = fopen(filename, "wb");
+    if (!host_out_file) {
+      perror(filename);
+      exit(1);
+    }
+    size_t len = strlen(filename);
+    host_out_is_wav = (len > 4) && !strcmp(filename + len - 4, ".wav");
+  }
+  if (host_out_is_wav) hostWriteWavHeader(0);  // sizes will be filled in by hostFinishRender()
+#else
+  (void) filename;
+#endif
+  clock_gettime(CLOCK_MONOTONIC, &host_render_start);
+}
+
+static void hostFinishRender() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  double wall = (now.tv_sec - host_render_start.tv_sec) + (now.tv_nsec - host_render_start.tv_nsec) / 1e9;
+  double rendered = (double) host_samples_rendered / MOZZI_AUDIO_RATE;
+
+  if (host_out_file) {
+    if (host_out_is_wav) {
+      fseek(host_out_file, 0, SEEK_SET);
+      hostWriteWavHeader((uint32_t) (host_samples_rendered * MOZZI_AUDIO_CHANNELS * 2));
+    }
+    if (host_out_file != stdout) fclose(host_out_file);
+    else fflush(stdout);
+  }
+
+  fprintf(stderr, "Mozzi: rendered %llu samples (%.2f s) in %.3f s wall time (%.1fx real time), %llu clipped.\n",
+          (unsigned long long) host_samples_rendered, rendered, wall, (wall > 0) ? rendered / wall : 0.0,
+          (unsigned long long) host_samples_clipped);
+  exit(0);
+}
+
+static void startAudio() {
+  // Nothing to do: output is driven from audioHook().
+}
+
+void stopMozzi() {
+  // Nothing to do: output is driven from audioHook().
+}
+////// END audio output code //////
+
+//// BEGIN Random seeding ////////
+void MozziRandPrivate::autoSeed() {
+  x = (uint32_t) time(nullptr);
+  y = (uint32_t) clock();
+  z = (uint32_t) (uintptr_t) &x;
+}
+//// END Random seeding ////////
+
+} // namespace MozziPrivate
+
+// The host clock follows the rendered audio, not the wall clock.
+unsigned long micros() {
+  return (unsigned long) ((uint64_t) audioTicks() * 1000000UL / MOZZI_AUDIO_RATE);
+}
+
+unsigned long millis() {
+  return (unsigned long) ((uint64_t) audioTicks() * 1000UL / MOZZI_AUDIO_RATE);
+}
+
+int main(int argc, char **argv) {
+  MozziPrivate::hostSetupRender(argc, argv);
+  setup();
+  while (true) {
+    loop();
+  }
+}
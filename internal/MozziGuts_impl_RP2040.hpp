@@ -15,6 +15,9 @@
 #endif
 
 #include <hardware/dma.h>
+#if (MOZZI_RP2040_AUDIO_CORE == 1)
+#include <atomic>
+#endif
 
 namespace MozziPrivate {
 
@@ -73,7 +76,17 @@ void rp2040_adc_queue_handler();
 
 static uint16_t rp2040_adc_result = 0;
 int rp2040_adc_dma_chan;
+#if (MOZZI_RP2040_AUDIO_CORE == 1)
+static int8_t rp2040_adc_deferred_speed = -1;
+#endif
 void setupMozziADC(int8_t speed) {
+#if (MOZZI_RP2040_AUDIO_CORE == 1)
+  // The DMA interrupt will fire on the core that enables it, and it needs to be the one running updateControl(). Defer to that core.
+  if (get_core_num() != 1) {
+    rp2040_adc_deferred_speed = speed;
+    return;
+  }
+#endif
   for (int i = 0; i < (int) NUM_ANALOG_INPUTS; ++i) {
     adc_gpio_init(i); 
   }
@@ -234,7 +247,7 @@ inline void audioOutput(const AudioOutput f) {
 #endif 
 
 
-static void startAudio() {
+static void startAudioOutput() {
 #if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PWM)
   
   gpio_set_drive_strength(MOZZI_AUDIO_PIN_1, GPIO_DRIVE_STRENGTH_12MA); // highest we can get
@@ -281,7 +294,7 @@ static void startAudio() {
 #endif
 }
 
-void stopMozzi() {
+static void stopAudioOutput() {
 #if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_TIMED)
   hardware_alarm_set_callback(audio_update_alarm_num, NULL);
 #elif MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_I2S_DAC)
@@ -291,6 +304,53 @@ void stopMozzi() {
 #endif
   
 }
+
+#if (MOZZI_RP2040_AUDIO_CORE == 1)
+/** Implementation notes:
+ *  - Core 1 does all the audio work: It renders audio (audioHook(), called from loop1()), and it owns the output device, and the ADC interrupt.
+ *    This way, the interrupt handlers of the output device (arduino-pico's PWMAudio / I2S are not designed to be fed from the other core) and of the ADC
+ *    never race against the rendering code.
+ *  - startMozzi() and stopMozzi() (on core 0) merely signal core 1 to start or stop.
+ *  - The output buffer used in EXTERNAL_TIMED mode is an SPSCFifo, and thus safe to use across cores, should the alarm interrupt ever fire on core 0.
+ */
+void audioHook();
+static std::atomic<bool> rp2040_audio_core_run(false);
+
+static void startAudio() {
+  rp2040_audio_core_run.store(true, std::memory_order_release);
+}
+
+void stopMozzi() {
+  rp2040_audio_core_run.store(false, std::memory_order_release);
+}
+
+static void rp2040AudioCoreLoop() {
+  static bool running = false;
+  if (rp2040_audio_core_run.load(std::memory_order_acquire) != running) {
+    running = !running;
+    if (running) {
+#  if MOZZI_IS(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_STANDARD)
+      if (rp2040_adc_deferred_speed >= 0) {
+        setupMozziADC(rp2040_adc_deferred_speed);
+        rp2040_adc_deferred_speed = -1;
+      }
+#  endif
+      startAudioOutput();
+    } else {
+      stopAudioOutput();
+    }
+  }
+  if (running) audioHook();
+}
+#else
+static void startAudio() {
+  startAudioOutput();
+}
+
+void stopMozzi() {
+  stopAudioOutput();
+}
+#endif
 ////// END audio output code //////
 
 //// BEGIN Random seeding ////////
@@ -301,5 +361,12 @@ void MozziRandPrivate::autoSeed() {
 
 } // namespace MozziPrivate
 
+#if (MOZZI_RP2040_AUDIO_CORE == 1)
+// arduino-pico runs this on core 1, repeatedly, if defined
+void loop1() {
+  MozziPrivate::rp2040AudioCoreLoop();
+}
+#endif
+
 #undef MOZZI_RP2040_BUFFERS
 #undef MOZZI_RP2040_BUFFER_SIZE
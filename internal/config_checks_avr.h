@@ -159,6 +159,11 @@ MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_CHANNELS, MOZZI_MONO)
 MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_RATE, 16384, 32768)
 #endif */
 
+// Beyond 256 cells, the buffer indices are 16 bit, and would not be read atomically by the output ISR
+#if (MOZZI_OUTPUT_BUFFER_SIZE > 256)
+#error "MOZZI_OUTPUT_BUFFER_SIZE must not be larger than 256 on AVR"
+#endif
+
 MOZZI_CHECK_SUPPORTED(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_NONE, MOZZI_ANALOG_READ_STANDARD)
 MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_INPUT, MOZZI_AUDIO_INPUT_NONE, MOZZI_AUDIO_INPUT_STANDARD)
 #include "../config/known_16bit_timers.h"
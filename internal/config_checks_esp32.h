@@ -75,6 +75,26 @@
  *
  * @section esp32_external MOZZI_OUTPUT_EXTERNAL_TIMED and MOZZI_OUTPUT_EXTERNAL_CUSTOM
  * See @ref external_audio
+ *
+ * @section esp32_render_task Rendering audio in a dedicated task
+ * In the I2S based modes (MOZZI_OUTPUT_INTERNAL_DAC, MOZZI_OUTPUT_I2S_DAC, MOZZI_OUTPUT_PDM_VIA_I2S), audio can be rendered by a dedicated, high priority
+ * FreeRTOS task, rather than from audioHook() in loop(). This task fills one DMA buffer at a time, and hands it to the I2S driver in a single call
+ * (rather than one call per sample), sleeping while the DMA buffers are full. Rendering then continues, even while loop() is held up, e.g. by networking code.
+ *
+ * @code
+ * #define MOZZI_ESP32_RENDER_TASK_CORE        ... // -1 (default): no separate task, render from audioHook(); 0 or 1: core to pin the render task to
+ * #define MOZZI_ESP32_RENDER_TASK_PRIORITY    ... // default: 20 (Arduino's loop() runs at priority 1)
+ * #define MOZZI_ESP32_RENDER_TASK_STACK_SIZE  ... // default: 4096
+ * @endcode
+ *
+ * Core 1 is a good choice on dual core ESP32s, as WiFi and Bluetooth run on core 0. Arduino's loop() also runs on core 1, and will only get
+ * CPU time, while the render task is waiting for the DMA buffers. On single core variants, the task is always pinned to core 0.
+ *
+ * Since updateControl() then runs in another task than loop(), do not share plain variables between the two. Instead, pass control parameters
+ * from loop() using a Mailbox, or an SPSCFifo. audioTicks() and mozziMicros() may be called from any task (the tick counter is a single word, updated
+ * atomically). Calling audioHook() in loop() becomes a no-op, in this mode. stopMozzi() lets the task finish the block it
+ * is rendering, and stop the output, and waits for it to exit. Called from updateControl() (i.e. from inside the task), stopMozzi() returns
+ * right away, and the task exits once the current block is done.
 */
 
 #if not IS_ESP32()
@@ -137,6 +157,23 @@ MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_INPUT, MOZZI_AUDIO_INPUT_NONE)
 #  define MOZZI_PDM_RESOLUTION 1  // unconditionally, no other value allowed
 #endif
 
+#if !defined(MOZZI_ESP32_RENDER_TASK_CORE)
+#  define MOZZI_ESP32_RENDER_TASK_CORE -1
+#endif
+MOZZI_CHECK_SUPPORTED(MOZZI_ESP32_RENDER_TASK_CORE, -1, 0, 1)
+#if (MOZZI_ESP32_RENDER_TASK_CORE >= 0)
+#  if !MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_INTERNAL_DAC, MOZZI_OUTPUT_I2S_DAC, MOZZI_OUTPUT_PDM_VIA_I2S)
+#    error MOZZI_ESP32_RENDER_TASK_CORE can only be used with the I2S based output modes
+#  endif
+#  if !defined(MOZZI_ESP32_RENDER_TASK_PRIORITY)
+#    define MOZZI_ESP32_RENDER_TASK_PRIORITY 20
+#  endif
+#  if !defined(MOZZI_ESP32_RENDER_TASK_STACK_SIZE)
+#    define MOZZI_ESP32_RENDER_TASK_STACK_SIZE 4096
+#  endif
+#  define MOZZI__SEPARATE_RENDER_TASK 1
+#endif
+
 // All modes besides timed external bypass the output buffer!
 #if !MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_TIMED)
 #  define BYPASS_MOZZI_OUTPUT_BUFFER true
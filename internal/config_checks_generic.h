@@ -17,6 +17,7 @@
  *   - @subpage hardware_avr
  *   - @subpage hardware_esp32
  *   - @subpage hardware_esp8266
+ *   - @subpage hardware_host
  *   - @subpage hardware_mbed
  *   - @subpage hardware_renesas
  *   - @subpage hardware_rp2040
@@ -64,6 +65,30 @@
 #  endif
 #endif
 
+#if not defined(MOZZI_AUDIO_BLOCK_SIZE)
+#define MOZZI_AUDIO_BLOCK_SIZE 1
+#endif
+
+#if not defined(MOZZI_OUTPUT_BUFFER_SIZE)
+#define MOZZI_OUTPUT_BUFFER_SIZE 256
+#endif
+
+#if not defined(MOZZI_CONTROL_TASKS)
+#define MOZZI_CONTROL_TASKS 0
+#endif
+
+#if not defined(MOZZI_EVENT_QUEUE_SIZE)
+#define MOZZI_EVENT_QUEUE_SIZE 0
+#endif
+
+#if not defined(MOZZI_LOAD_METER)
+#define MOZZI_LOAD_METER MOZZI_LOAD_METER_NONE
+#endif
+
+#if not defined(MOZZI_PROFILER)
+#define MOZZI_PROFILER MOZZI_PROFILER_NONE
+#endif
+
 //MOZZI_ANALOG_READ -> hardware specific, but we want to insert a warning, if not supported, and user has not explicitly configured anything
 #if not defined(MOZZI_ANALOG_READ)
 #define MOZZI__ANALOG_READ_NOT_CONFIGURED
@@ -106,6 +131,8 @@
 #include "config_checks_stm32maple.h"
 #elif (IS_TEENSY3() || IS_TEENSY4())
 #include "config_checks_teensy.h"
+#elif IS_HOST()
+#include "config_checks_host.h"
 #else
 #error Problem detecting hardware
 #endif
@@ -121,6 +148,26 @@
 /// Step 3: Apply various generic checks that make sense on more than one platform
 MOZZI_CHECK_POW2(MOZZI_AUDIO_RATE)
 MOZZI_CHECK_POW2(MOZZI_CONTROL_RATE)
+MOZZI_CHECK_POW2(MOZZI_AUDIO_BLOCK_SIZE)
+MOZZI_CHECK_POW2(MOZZI_OUTPUT_BUFFER_SIZE)
+MOZZI_CHECK_SUPPORTED(MOZZI_LOAD_METER, MOZZI_LOAD_METER_NONE, MOZZI_LOAD_METER_ENABLED)
+MOZZI_CHECK_SUPPORTED(MOZZI_PROFILER, MOZZI_PROFILER_NONE, MOZZI_PROFILER_ENABLED)
+
+#if (MOZZI_OUTPUT_BUFFER_SIZE < 2) || (MOZZI_OUTPUT_BUFFER_SIZE > 32768)
+#error "MOZZI_OUTPUT_BUFFER_SIZE must be between 2 and 32768"
+#endif
+
+#if (MOZZI_CONTROL_TASKS < 0) || (MOZZI_CONTROL_TASKS > 32)
+#error "MOZZI_CONTROL_TASKS must be between 0 and 32"
+#endif
+
+#if (MOZZI_EVENT_QUEUE_SIZE < 0) || (MOZZI_EVENT_QUEUE_SIZE > 255)
+#error "MOZZI_EVENT_QUEUE_SIZE must be between 0 and 255"
+#endif
+
+#if (MOZZI_AUDIO_BLOCK_SIZE > 1) && !MOZZI_IS(MOZZI_AUDIO_INPUT, MOZZI_AUDIO_INPUT_NONE)
+#error "MOZZI_AUDIO_BLOCK_SIZE > 1 cannot currently be combined with MOZZI_AUDIO_INPUT"
+#endif
 
 #if MOZZI_IS(MOZZI_AUDIO_INPUT, MOZZI_AUDIO_INPUT_STANDARD) && MOZZI_IS(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_NONE)
 #error "MOZZI_AUDIO_INPUT depends on MOZZI_ANALOG_READ option"
@@ -139,7 +186,7 @@ MOZZI_CHECK_POW2(MOZZI_CONTROL_RATE)
 #endif
 
 // Hardware-specific checks file should have more narrow checks for most options, below, but is not required to, so let's check for anything that is wildly out of scope:
-MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PWM, MOZZI_OUTPUT_2PIN_PWM, MOZZI_OUTPUT_EXTERNAL_TIMED, MOZZI_OUTPUT_EXTERNAL_CUSTOM, MOZZI_OUTPUT_PDM_VIA_I2S, MOZZI_OUTPUT_PDM_VIA_SERIAL, MOZZI_OUTPUT_I2S_DAC, MOZZI_OUTPUT_INTERNAL_DAC)
+MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_PWM, MOZZI_OUTPUT_2PIN_PWM, MOZZI_OUTPUT_EXTERNAL_TIMED, MOZZI_OUTPUT_EXTERNAL_CUSTOM, MOZZI_OUTPUT_PDM_VIA_I2S, MOZZI_OUTPUT_PDM_VIA_SERIAL, MOZZI_OUTPUT_I2S_DAC, MOZZI_OUTPUT_INTERNAL_DAC, MOZZI_OUTPUT_FILE)
 MOZZI_CHECK_SUPPORTED(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_NONE, MOZZI_ANALOG_READ_STANDARD)
 
 #if defined(MOZZI__ANALOG_READ_NOT_CONFIGURED)
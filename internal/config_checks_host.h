@@ -0,0 +1,106 @@
+/*
+ * config_checks_host.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+*/
+
+#ifndef CONFIG_CHECK_HOST_H
+#define CONFIG_CHECK_HOST_H
+
+/**
+ * @page hardware_host Mozzi on a desktop host (Linux, macOS)
+ *
+ * @section host_status Port status and notes
+ * This is not a microcontroller port. It allows compiling an (unmodified) Mozzi sketch as a regular desktop program, which then renders audio as fast as the CPU
+ * allows, writing the result to a file or to stdout. This is useful for prototyping patches, for profiling the cost of DSP code, and for rendering hours of
+ * audio in seconds, in order to catch drift or overflow bugs that only show up after a long time.
+ *
+ *   - There is no Arduino core on the host. A minimal replacement for Arduino.h is provided in extras/host/ . You will also need the FixMath library.
+ *   - The port provides main(), which calls setup() once, and then loop() until the configured amount of audio has been rendered.
+ *   - There is no timer. Instead, audioHook() drains the output buffer, whenever it is too full for the next sample (or block,
+ *     see @ref MOZZI_AUDIO_BLOCK_SIZE). Thus audioTicks() and mozziMicros()
+ *     behave as on real hardware, and the buffer lags behind updateAudio() by the same amount.
+ *   - millis() and micros() follow the audio clock (i.e. the number of rendered samples), not the wall clock. delay() returns immediately.
+ *   - Analog reads are not available. mozziAnalogRead() relays to analogRead(), which always returns 0.
+ *   - At the end of the render, a short summary (number of samples, clipped samples, speed relative to real time) is printed to stderr.
+ *
+ * To compile, e.g. the Sinewave example:
+ * @code
+ * g++ -O2 -x c++ -I/path/to/Mozzi -I/path/to/Mozzi/extras/host -I/path/to/FixMath/src \
+ *     examples/01.Basics/Sinewave/Sinewave.ino -x none /path/to/Mozzi/mozzi_fixmath.cpp -o sinewave
+ * ./sinewave sinewave.wav 60      # render one minute of audio to a WAV file
+ * ./sinewave - 10 | aplay -f S16_LE -r 32768    # or pipe raw samples to stdout
+ * @endcode
+ *
+ * The first command line argument is the output file. If it ends in ".wav", a WAV header is written, otherwise raw signed 16 bit little endian samples.
+ * "-" (the default) means stdout. The second argument is the length of the render in seconds (may be fractional), defaulting to MOZZI_HOST_RENDER_SECONDS.
+ *
+ * @note
+ * The Arduino IDE automatically generates prototypes for all functions in a .ino file. A plain compiler does not, so sketches calling a function before its
+ * definition need an explicit declaration to compile on the host.
+ *
+ * @section host_output Output modes
+ * The following audio modes (see @ref MOZZI_AUDIO_MODE) are currently supported on this hardware:
+ *   - MOZZI_OUTPUT_FILE
+ *   - MOZZI_OUTPUT_EXTERNAL_TIMED
+ *   - MOZZI_OUTPUT_EXTERNAL_CUSTOM
+ *
+ * The default mode is @ref host_file .
+ *
+ * @section host_file MOZZI_OUTPUT_FILE
+ * Samples are written as signed 16 bit values, mono or stereo (interleaved). If MOZZI_AUDIO_BITS differs from 16, samples are shifted, accordingly.
+ * Samples exceeding the 16 bit range are clipped (and counted). Configuration options:
+ *
+ * @code
+ * #define MOZZI_AUDIO_BITS             ... // default is 16
+ * #define MOZZI_HOST_RENDER_SECONDS    ... // default length of the render, if not given on the command line; default is 10
+ * @endcode
+ *
+ * @section host_external MOZZI_OUTPUT_EXTERNAL_TIMED and MOZZI_OUTPUT_EXTERNAL_CUSTOM
+ * See @ref external_audio . In MOZZI_OUTPUT_EXTERNAL_TIMED mode, your audioOutput() is called as fast as possible, and the render stops after the configured
+ * length. In MOZZI_OUTPUT_EXTERNAL_CUSTOM mode, pacing and stopping is entirely up to your sketch.
+*/
+
+#if not IS_HOST()
+#error This header should be included for desktop host builds, only
+#endif
+
+#include "disable_2pinmode_on_github_workflow.h"
+#if !defined(MOZZI_AUDIO_MODE)
+#  define MOZZI_AUDIO_MODE MOZZI_OUTPUT_FILE
+#endif
+MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_FILE, MOZZI_OUTPUT_EXTERNAL_TIMED, MOZZI_OUTPUT_EXTERNAL_CUSTOM)
+
+#if !defined(MOZZI_AUDIO_RATE)
+#  define MOZZI_AUDIO_RATE 32768
+#endif
+
+#if defined(MOZZI_PWM_RATE)
+#error Configuration of MOZZI_PWM_RATE is not supported on this platform
+#endif
+
+#if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_FILE)
+#  if !defined(MOZZI_AUDIO_BITS)
+#    define MOZZI_AUDIO_BITS 16
+#  endif
+#endif
+
+#if !defined(MOZZI_HOST_RENDER_SECONDS)
+#  define MOZZI_HOST_RENDER_SECONDS 10
+#endif
+
+#if !defined(MOZZI_ANALOG_READ)
+#  define MOZZI_ANALOG_READ MOZZI_ANALOG_READ_NONE
+#endif
+
+MOZZI_CHECK_SUPPORTED(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_NONE)
+MOZZI_CHECK_SUPPORTED(MOZZI_AUDIO_INPUT, MOZZI_AUDIO_INPUT_NONE)
+
+#define MOZZI__INTERNAL_ANALOG_READ_RESOLUTION 10
+
+#endif        //  #ifndef CONFIG_CHECK_HOST_H
@@ -25,7 +25,7 @@
  *   - Wavetables and samples are not kept in progmem on this platform. While apparently speed (of the external flash) is not much of an issue, the data always seems to be copied into RAM, anyway.
  *   - Note that getAudioInput() and mozziAnalogRead() return values in the RP2040's full ADC resolution of 0-4095 rather than AVR's 0-1023.
  *   - twi_nonblock is not ported
- *   - Code uses only one CPU core
+ *   - By default, code uses only one CPU core. Audio rendering can be moved to the second core, see @ref rp2040_audio_core .
  *
  * @section rp2040_output Output modes
  * The following audio modes (see @ref MOZZI_AUDIO_MODE) are currently supported on this hardware:
@@ -67,6 +67,25 @@
  *
  * @section rp2040_external MOZZI_OUTPUT_EXTERNAL_TIMED and MOZZI_OUTPUT_EXTERNAL_CUSTOM
  * See @ref external_audio
+ *
+ * @section rp2040_audio_core Rendering audio on the second core
+ * @code
+ * #define MOZZI_RP2040_AUDIO_CORE   ...  // 0 (default) or 1
+ * @endcode
+ *
+ * When set to 1, all of Mozzi's work - updateAudio(), updateControl(), the output device, and asynchronous analog reads - is moved to core 1,
+ * leaving core 0 free for your sketch's own loop() (e.g. USB MIDI, or a display). Calling audioHook() in loop() becomes a no-op, then (but
+ * does no harm). startMozzi() and stopMozzi() are still called from core 0, as usual, and take effect on core 1, shortly after.
+ *
+ * Since updateControl() then runs on the other core than loop(), do not share plain variables between the two. Instead, pass control
+ * parameters from loop() to updateControl() using a Mailbox (for the latest value of a set of parameters), or an SPSCFifo (for a queue of events,
+ * such as notes).
+ *
+ * Things to keep in mind:
+ *   - Mozzi provides loop1() in this mode. Your sketch must not define loop1() (setup1() is fine).
+ *   - Call mozziAnalogRead() from updateControl(), only.
+ *   - audioTicks() and mozziMicros() may be called from either core (the tick counter is a single word, updated atomically).
+ *   - This mode cannot be combined with MOZZI_OUTPUT_EXTERNAL_CUSTOM.
 */
 
 #if not IS_RP2040()
@@ -122,6 +141,17 @@ MOZZI_CHECK_SUPPORTED(MOZZI_I2S_FORMAT, MOZZI_I2S_FORMAT_PLAIN, MOZZI_I2S_FORMAT
 #  define MOZZI_ANALOG_READ MOZZI_ANALOG_READ_STANDARD
 #endif
 
+#if !defined(MOZZI_RP2040_AUDIO_CORE)
+#  define MOZZI_RP2040_AUDIO_CORE 0
+#endif
+MOZZI_CHECK_SUPPORTED(MOZZI_RP2040_AUDIO_CORE, 0, 1)
+#if (MOZZI_RP2040_AUDIO_CORE == 1)
+#  if MOZZI_IS(MOZZI_AUDIO_MODE, MOZZI_OUTPUT_EXTERNAL_CUSTOM)
+#    error MOZZI_RP2040_AUDIO_CORE 1 cannot be combined with MOZZI_OUTPUT_EXTERNAL_CUSTOM
+#  endif
+#  define MOZZI__SEPARATE_RENDER_TASK 1
+#endif
+
 #define MOZZI__INTERNAL_ANALOG_READ_RESOLUTION 12
 
 MOZZI_CHECK_SUPPORTED(MOZZI_ANALOG_READ, MOZZI_ANALOG_READ_NONE, MOZZI_ANALOG_READ_STANDARD)
@@ -0,0 +1,83 @@
+/*
+ * mozzi_cycle_counter.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+*/
+
+#ifndef MOZZI_CYCLE_COUNTER_H
+#define MOZZI_CYCLE_COUNTER_H
+
+/** Free running 32 bit counter of CPU cycles, for measuring the cost of code (see MOZZI_LOAD_METER). Where the CPU offers a cycle counter, that is used:
+ *  - ARM Cortex-M3/M4/M7: the DWT cycle counter
+ *  - ESP32, ESP8266: the CCOUNT register
+ *  Elsewhere, micros() is used, and scaled to F_CPU, so results are in the same unit, but with a resolution of (at best) one microsecond.
+ *  On the host, the counter runs at 1 GHz (nanoseconds).
+ *
+ *  Differences of two readings are correct across a wrap around of the counter, as long as the measured code takes less than 2^32 cycles. */
+
+#include <Arduino.h>
+#include "../hardware_defines.h"
+#if IS_HOST()
+#include <time.h>
+#endif
+
+namespace MozziPrivate {
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#  define MOZZI__HAVE_DWT_CYCCNT 1
+#  define MOZZI__DWT_CTRL   (*(volatile uint32_t *) 0xE0001000)
+#  define MOZZI__DWT_CYCCNT (*(volatile uint32_t *) 0xE0001004)
+#  define MOZZI__DWT_LAR    (*(volatile uint32_t *) 0xE0001FB0)
+#  define MOZZI__DEMCR      (*(volatile uint32_t *) 0xE000EDFC)
+#endif
+
+/** Must be called once, before using mozziCycleCount(). Does no harm, if called more often. */
+inline void mozziCycleCounterInit() {
+#if defined(MOZZI__HAVE_DWT_CYCCNT)
+  MOZZI__DEMCR |= (1UL << 24);  // TRCENA: enable DWT
+  MOZZI__DWT_LAR = 0xC5ACCE55;  // unlock (needed on Cortex-M7, no effect elsewhere)
+  MOZZI__DWT_CTRL |= 1;         // CYCCNTENA
+#endif
+}
+
+inline uint32_t mozziCycleCount() {
+#if defined(MOZZI__HAVE_DWT_CYCCNT)
+  return MOZZI__DWT_CYCCNT;
+#elif IS_ESP32() || IS_ESP8266()
+  return ESP.getCycleCount();
+#elif IS_HOST()
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t) ((uint64_t) now.tv_sec * 1000000000ULL + now.tv_nsec);
+#elif defined(F_CPU)
+  return micros() * (F_CPU / 1000000UL);
+#else
+  return micros();
+#endif
+}
+
+/** Rate of mozziCycleCount(), in Hz */
+inline uint32_t mozziCycleCounterHz() {
+#if IS_HOST()
+  return 1000000000UL;
+#elif IS_ESP32()
+  return getCpuFrequencyMhz() * 1000000UL;
+#elif IS_ESP8266()
+  return ESP.getCpuFreqMHz() * 1000000UL;
+#elif defined(F_CPU)
+  return F_CPU;
+#elif defined(MOZZI__HAVE_DWT_CYCCNT)
+  return SystemCoreClock;
+#else
+  return 1000000UL;
+#endif
+}
+
+}
+
+#endif
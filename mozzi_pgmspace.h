@@ -17,7 +17,7 @@
 
 #include "hardware_defines.h"
 
-#if IS_ESP8266() || IS_ESP32() || IS_RP2040() || IS_RENESAS()
+#if IS_ESP8266() || IS_ESP32() || IS_RP2040() || IS_RENESAS() || IS_HOST()
 template<typename T> inline T FLASH_OR_RAM_READ(T* address) {
     return (T) (*address);
 }
@@ -0,0 +1,117 @@
+/*
+ * mozzi_profile.h
+ *
+ * This file is part of Mozzi.
+ *
+ * Copyright 2024 the Mozzi Team
+ *
+ * Mozzi is licensed under the GNU Lesser General Public Licence (LGPL) Version 2.1 or later.
+ *
+ */
+
+#ifndef MOZZI_PROFILE_H_
+#define MOZZI_PROFILE_H_
+
+#include <Arduino.h>
+#include "MozziConfigValues.h"
+#include "internal/mozzi_macros.h"
+
+#if defined(MOZZI_PROFILER) && MOZZI_IS(MOZZI_PROFILER, MOZZI_PROFILER_ENABLED)
+#include "internal/mozzi_cycle_counter.h"
+
+#if !defined(MOZZI_PROFILE_MAX_SCOPES)
+#define MOZZI_PROFILE_MAX_SCOPES 16
+#endif
+
+namespace MozziPrivate {
+
+struct MozziProfileEntry {
+  const char *name;
+  uint32_t calls;
+  uint64_t cycles;
+};
+
+inline MozziProfileEntry *mozziProfileTable() {
+  static MozziProfileEntry table[MOZZI_PROFILE_MAX_SCOPES];
+  return table;
+}
+
+/* Returns the table entry for the given name, adding it, if not yet present. All scopes of the same name (e.g. the next() function in
+ * different instantiations of a template) share one entry. Returns nullptr, if the table is full. */
+inline MozziProfileEntry *mozziProfileRegister(const char *name) {
+  mozziCycleCounterInit();
+  MozziProfileEntry *table = mozziProfileTable();
+  for (uint8_t i = 0; i < MOZZI_PROFILE_MAX_SCOPES; ++i) {
+    if (!table[i].name) {
+      table[i].name = name;
+      return &table[i];
+    }
+    if (!strcmp(table[i].name, name)) return &table[i];
+  }
+  return nullptr;
+}
+
+class MozziProfileScope {
+public:
+  MozziProfileScope(MozziProfileEntry *entry) : entry(entry), start(mozziCycleCount()) {}
+  ~MozziProfileScope() {
+    if (entry) {
+      entry->cycles += mozziCycleCount() - start;
+      ++entry->calls;
+    }
+  }
+private:
+  MozziProfileEntry *entry;
+  uint32_t start;
+};
+
+}
+
+#define MOZZI__PROFILE_CONCAT2(a, b) a##b
+#define MOZZI__PROFILE_CONCAT(a, b) MOZZI__PROFILE_CONCAT2(a, b)
+#define MOZZI_PROFILE_SCOPE(name) \
+  static MozziPrivate::MozziProfileEntry *MOZZI__PROFILE_CONCAT(mozzi_profile_entry_, __LINE__) = MozziPrivate::mozziProfileRegister(name); \
+  MozziPrivate::MozziProfileScope MOZZI__PROFILE_CONCAT(mozzi_profile_scope_, __LINE__)(MOZZI__PROFILE_CONCAT(mozzi_profile_entry_, __LINE__))
+
+/** @ingroup util
+Print the number of calls, the average number of CPU cycles per call, and the total time (in milliseconds) spent in each scope
+instrumented with MOZZI_PROFILE_SCOPE(), since the start, or the last call to mozziProfileReset(). Only available with @ref MOZZI_PROFILER enabled.
+Times of nested scopes are included in the times of the enclosing scopes.
+@param out where to print to, e.g. Serial
+*/
+inline void mozziProfileReport(Print &out) {
+  MozziPrivate::MozziProfileEntry *table = MozziPrivate::mozziProfileTable();
+  uint32_t cycles_per_ms = MozziPrivate::mozziCycleCounterHz() / 1000;
+  for (uint8_t i = 0; i < MOZZI_PROFILE_MAX_SCOPES; ++i) {
+    if (!table[i].name) break;
+    out.print(table[i].name);
+    out.print(": calls: ");
+    out.print(table[i].calls);
+    out.print(" cycles/call: ");
+    out.print(table[i].calls ? (uint32_t) (table[i].cycles / table[i].calls) : 0ul);
+    out.print(" total ms: ");
+    out.println((uint32_t) (table[i].cycles / cycles_per_ms));
+  }
+}
+
+/** @ingroup util
+Reset all counts of the profiler. Only available with @ref MOZZI_PROFILER enabled.
+*/
+inline void mozziProfileReset() {
+  MozziPrivate::MozziProfileEntry *table = MozziPrivate::mozziProfileTable();
+  for (uint8_t i = 0; i < MOZZI_PROFILE_MAX_SCOPES; ++i) {
+    table[i].calls = 0;
+    table[i].cycles = 0;
+  }
+}
+
+#else
+/** @ingroup util
+Measure the number of calls to, and CPU cycles spent in the enclosing scope (typically a function), see mozziProfileReport(). When
+@ref MOZZI_PROFILER is not enabled, this compiles to nothing.
+@param name a name for the scope, as a string literal. Scopes of the same name are counted together.
+*/
+#define MOZZI_PROFILE_SCOPE(name)
+#endif
+
+#endif        //  #ifndef MOZZI_PROFILE_H_
@@ -17,6 +17,9 @@
 
 #include "hardware_defines.h"
 
+/** Interpolation modes for playing back tables, used by Sample and Oscil */
+enum interpolation {INTERP_NONE, INTERP_LINEAR};
+
 // macros for setting and clearing register bits
 #ifndef cbi
 #define cbi(sfr, bit) (_SFR_UINT8_T(sfr) &= ~_BV(bit))
@@ -0,0 +1,541 @@
+#ifndef BURROUGHS1_18649_ADPCM_H_
+#define BURROUGHS1_18649_ADPCM_H_
+ 
+#include <Arduino.h>
+#include "mozzi_pgmspace.h"
+ 
+#define BURROUGHS1_18649_ADPCM_NUM_CELLS 18649
+#define BURROUGHS1_18649_ADPCM_SAMPLERATE 16384
+#define BURROUGHS1_18649_ADPCM_BLOCK_SAMPLES 256
+ 
+CONSTTABLE_STORAGE(uint8_t) BURROUGHS1_18649_ADPCM_DATA [] = {0, 8, 0, 112, 119,
+255, 86, 22, 18, 153, 10, 138, 1, 35, 151, 205, 26, 48, 48, 202, 168, 216, 184,
+19, 8, 169, 255, 159, 129, 8, 161, 173, 35, 137, 100, 144, 10, 0, 72, 3, 170,
+51, 216, 25, 2, 41, 145, 190, 32, 131, 16, 19, 189, 25, 18, 50, 19, 251, 11, 33,
+38, 16, 176, 203, 140, 89, 145, 44, 3, 190, 16, 19, 0, 128, 56, 145, 143, 97,
+129, 24, 152, 25, 135, 137, 50, 170, 234, 25, 2, 16, 16, 154, 191, 57, 21, 154,
+160, 255, 11, 18, 0, 169, 188, 40, 144, 81, 148, 154, 130, 72, 53, 144, 25, 152,
+42, 53, 130, 177, 158, 128, 16, 50, 201, 138, 128, 130, 22, 19, 16, 50, 56, 0,
+8, 38, 151, 10, 168, 176, 48, 39, 10, 82, 205, 57, 243, 42, 133, 187, 0, 171,
+50, 188, 42, 217, 10, 23, 153, 33, 1, 0, 136, 48, 52, 40, 114, 145, 11, 81, 20,
+160, 152, 160, 39, 178, 190, 175, 48, 144, 169, 233, 27, 3, 138, 50, 189, 33,
+128, 49, 211, 48, 6, 24, 50, 152, 144, 56, 147, 28, 52, 8, 132, 192, 8, 208, 49,
+160, 112, 17, 56, 128, 41, 178, 58, 55, 191, 66, 136, 32, 204, 138, 136, 253,
+26, 161, 157, 144, 138, 33, 176, 65, 176, 90, 3, 48, 7, 8, 36, 8, 98, 146, 41,
+20, 137, 68, 168, 137, 162, 140, 132, 175, 32, 185, 207, 40, 130, 171, 170, 26,
+4, 138, 16, 144, 0, 226, 51, 90, 67, 52, 129, 49, 35, 64, 66, 17, 25, 66, 133,
+1, 133, 137, 32, 218, 139, 190, 157, 170, 204, 152, 201, 136, 152, 48, 136, 56,
+168, 64, 19, 115, 34, 53, 35, 70, 16, 17, 1, 1, 184, 152, 172, 251, 16, 248,
+139, 152, 25, 162, 175, 32, 144, 35, 136, 84, 129, 49, 3, 32, 35, 66, 68, 50,
+67, 52, 144, 187, 241, 143, 160, 159, 168, 174, 19, 185, 144, 170, 66, 144, 10,
+9, 32, 66, 67, 34, 36, 67, 22, 129, 0, 8, 17, 154, 154, 156, 184, 28, 181, 158,
+128, 41, 18, 11, 99, 65, 17, 48, 5, 152, 145, 83, 19, 11, 66, 26, 251, 175, 248,
+154, 152, 11, 8, 25, 145, 3, 153, 0, 204, 55, 53, 205, 96, 129, 24, 19, 98, 3,
+24, 2, 128, 186, 152, 235, 137, 185, 171, 161, 155, 2, 27, 113, 33, 69, 34, 23,
+17, 34, 50, 52, 161, 159, 83, 201, 172, 185, 188, 200, 203, 136, 25, 136, 59,
+145, 48, 146, 120, 37, 17, 38, 34, 35, 32, 130, 26, 185, 12, 251, 155, 176, 200,
+170, 42, 137, 72, 16, 68, 35, 68, 34, 83, 33, 35, 19, 22, 176, 189, 156, 205,
+157, 153, 153, 168, 16, 144, 0, 169, 50, 128, 103, 34, 82, 50, 34, 1, 128, 201,
+185, 201, 170, 203, 187, 174, 169, 171, 40, 48, 70, 35, 18, 85, 2, 17, 1, 115,
+2, 24, 169, 204, 233, 220, 137, 152, 153, 24, 1, 24, 168, 0, 172, 62, 40, 147,
+80, 55, 35, 67, 36, 129, 25, 169, 171, 202, 11, 169, 190, 203, 153, 234, 25, 17,
+98, 18, 67, 2, 18, 19, 21, 50, 84, 32, 185, 190, 201, 252, 137, 136, 8, 24, 129,
+137, 168, 42, 17, 72, 71, 19, 18, 19, 170, 138, 187, 171, 186, 90, 193, 191,
+170, 176, 154, 97, 98, 33, 49, 131, 144, 18, 49, 84, 51, 21, 176, 251, 156, 219,
+141, 128, 0, 128, 18, 184, 138, 170, 82, 17, 116, 50, 129, 0, 176, 173, 136,
+136, 17, 8, 129, 250, 173, 9, 136, 66, 53, 20, 17, 128, 153, 169, 32, 69, 36,
+33, 176, 207, 156, 202, 156, 1, 18, 0, 2, 185, 154, 171, 84, 35, 69, 51, 128,
+155, 0, 45, 67, 217, 219, 128, 16, 49, 136, 152, 251, 203, 40, 17, 98, 52, 130,
+136, 144, 187, 49, 82, 38, 17, 145, 219, 207, 137, 185, 41, 34, 34, 8, 195, 157,
+144, 73, 52, 64, 35, 129, 219, 170, 186, 27, 17, 66, 145, 169, 191, 186, 26, 39,
+34, 68, 18, 169, 153, 153, 33, 83, 84, 1, 128, 233, 220, 138, 185, 42, 51, 18,
+136, 162, 174, 136, 88, 52, 34, 18, 146, 221, 138, 152, 10, 34, 34, 168, 217,
+157, 136, 58, 55, 50, 18, 130, 218, 10, 136, 64, 52, 53, 128, 144, 205, 221,
+138, 168, 41, 35, 2, 138, 179, 173, 1, 98, 51, 34, 18, 193, 191, 9, 152, 25, 36,
+152, 128, 201, 187, 49, 50, 103, 0, 17, 73, 1, 1, 128, 186, 9, 131, 114, 18, 65,
+0, 144, 252, 219, 138, 185, 43, 36, 130, 136, 131, 156, 1, 113, 35, 18, 144,
+144, 237, 138, 0, 136, 65, 130, 170, 168, 202, 64, 0, 116, 17, 128, 136, 161,
+10, 145, 112, 3, 16, 67, 2, 0, 194, 255, 156, 152, 139, 33, 4, 0, 130, 171, 16,
+24, 116, 18, 136, 130, 204, 171, 24, 137, 66, 34, 146, 203, 160, 26, 52, 114,
+131, 40, 209, 138, 153, 82, 16, 51, 48, 5, 49, 4, 34, 232, 255, 139, 184, 137,
+65, 4, 9, 130, 12, 144, 56, 52, 19, 169, 0, 223, 137, 128, 40, 18, 19, 152, 176,
+143, 3, 56, 6, 0, 170, 152, 189, 48, 65, 2, 35, 0, 34, 62, 144, 33, 17, 103, 33,
+17, 169, 255, 141, 160, 9, 33, 20, 9, 145, 140, 130, 40, 51, 22, 170, 152, 188,
+154, 16, 50, 20, 16, 138, 178, 15, 2, 97, 129, 144, 188, 186, 11, 67, 51, 39,
+145, 138, 152, 65, 68, 67, 18, 145, 187, 255, 142, 136, 136, 17, 35, 137, 145,
+12, 2, 72, 18, 35, 235, 152, 203, 136, 32, 51, 34, 161, 41, 242, 26, 0, 18, 27,
+194, 175, 169, 137, 73, 23, 16, 2, 0, 184, 49, 128, 103, 0, 33, 136, 129, 189,
+254, 11, 160, 25, 18, 36, 8, 146, 29, 130, 41, 34, 3, 204, 168, 188, 136, 8, 84,
+34, 0, 128, 168, 137, 128, 41, 241, 156, 170, 8, 25, 19, 114, 0, 245, 64, 3, 33,
+32, 4, 10, 2, 36, 136, 71, 129, 53, 160, 136, 220, 255, 138, 144, 24, 17, 22,
+25, 161, 42, 162, 49, 24, 134, 156, 185, 155, 137, 65, 50, 33, 2, 17, 160, 24,
+80, 195, 157, 202, 187, 140, 136, 116, 18, 8, 65, 160, 9, 152, 136, 50, 185, 69,
+0, 52, 33, 129, 100, 193, 204, 223, 9, 136, 0, 81, 2, 40, 200, 16, 136, 2, 72,
+194, 139, 235, 137, 9, 49, 82, 35, 8, 145, 155, 144, 64, 179, 9, 252, 170, 154,
+1, 56, 39, 17, 8, 17, 153, 32, 161, 156, 168, 9, 82, 36, 100, 128, 40, 25, 133,
+72, 145, 254, 174, 128, 137, 32, 52, 1, 130, 156, 129, 40, 8, 52, 188, 0, 1, 69,
+186, 158, 137, 49, 50, 54, 129, 8, 144, 139, 51, 160, 153, 249, 173, 153, 154,
+49, 68, 2, 16, 2, 184, 41, 19, 153, 137, 191, 129, 62, 23, 72, 145, 33, 137, 3,
+105, 22, 170, 251, 175, 136, 136, 17, 99, 145, 17, 170, 16, 25, 130, 99, 216,
+153, 172, 137, 56, 3, 115, 130, 8, 152, 128, 24, 18, 128, 217, 190, 154, 138,
+50, 52, 52, 145, 153, 203, 17, 25, 22, 16, 208, 171, 155, 17, 84, 35, 52, 129,
+155, 50, 128, 22, 137, 250, 251, 207, 129, 9, 18, 99, 144, 18, 172, 146, 42,
+161, 66, 203, 160, 141, 160, 64, 17, 52, 34, 152, 153, 156, 0, 0, 154, 161, 175,
+186, 8, 81, 37, 49, 0, 30, 68, 18, 144, 222, 137, 8, 16, 66, 130, 154, 185, 24,
+24, 23, 40, 131, 169, 136, 187, 115, 3, 136, 48, 241, 143, 250, 28, 144, 17, 48,
+7, 26, 177, 25, 169, 20, 43, 196, 43, 200, 8, 28, 21, 40, 2, 16, 152, 128, 156,
+145, 9, 152, 184, 142, 168, 24, 114, 4, 66, 128, 160, 171, 252, 26, 128, 1, 72,
+132, 25, 160, 16, 9, 4, 90, 149, 139, 1, 168, 90, 163, 42, 131, 232, 13, 248,
+31, 144, 40, 24, 6, 43, 178, 57, 217, 18, 43, 165, 44, 168, 136, 10, 19, 88, 3,
+33, 128, 160, 13, 161, 11, 17, 192, 155, 154, 137, 59, 55, 84, 128, 129, 12,
+201, 234, 13, 4, 25, 17, 35, 172, 0, 253, 69, 2, 155, 20, 137, 34, 177, 140, 36,
+200, 97, 146, 32, 153, 201, 11, 255, 27, 168, 1, 112, 163, 72, 160, 16, 154,
+147, 105, 193, 25, 200, 144, 28, 147, 88, 2, 34, 137, 193, 42, 184, 17, 42, 242,
+27, 200, 9, 9, 35, 84, 130, 49, 200, 184, 140, 252, 74, 145, 0, 97, 177, 41,
+160, 128, 72, 176, 83, 185, 33, 137, 176, 115, 162, 49, 170, 232, 187, 255, 1,
+10, 1, 82, 168, 35, 140, 162, 58, 160, 68, 171, 132, 140, 184, 56, 168, 69, 25,
+133, 9, 168, 1, 171, 19, 26, 208, 10, 202, 9, 8, 84, 34, 1, 49, 224, 154, 152,
+223, 48, 0, 8, 99, 160, 137, 8, 160, 66, 154, 37, 138, 0, 18, 64, 16, 66, 138,
+67, 177, 187, 153, 248, 251, 143, 161, 25, 24, 38, 137, 4, 43, 210, 40, 136,
+131, 142, 129, 155, 168, 65, 9, 38, 41, 132, 9, 168, 131, 158, 130, 9, 185, 42,
+217, 8, 24, 23, 32, 1, 130, 186, 169, 205, 140, 20, 42, 4, 34, 186, 163, 29,
+145, 35, 141, 6, 25, 130, 48, 24, 51, 154, 137, 140, 250, 255, 11, 184, 16, 80,
+5, 41, 161, 56, 202, 35, 42, 181, 27, 208, 139, 186, 51, 74, 7, 32, 146, 24,
+155, 146, 44, 164, 41, 251, 136, 171, 130, 88, 3, 49, 0, 194, 30, 178, 172, 89,
+132, 27, 35, 168, 172, 1, 25, 2, 88, 34, 136, 112, 2, 186, 54, 137, 161, 41, 0,
+53, 61, 250, 185, 255, 0, 138, 2, 98, 160, 49, 171, 3, 28, 147, 120, 200, 0,
+170, 144, 26, 147, 113, 129, 17, 137, 161, 58, 177, 98, 185, 1, 175, 160, 41,
+144, 68, 0, 130, 9, 184, 42, 187, 176, 112, 180, 32, 16, 161, 28, 0, 24, 16, 1,
+97, 128, 133, 121, 177, 36, 24, 164, 12, 200, 250, 175, 1, 10, 130, 68, 176, 19,
+155, 133, 43, 131, 81, 235, 0, 170, 152, 58, 147, 114, 144, 34, 137, 145, 80,
+176, 49, 186, 208, 142, 177, 40, 144, 67, 0, 144, 57, 192, 128, 17, 237, 82,
+168, 16, 32, 202, 24, 137, 0, 49, 160, 55, 11, 149, 48, 169, 55, 26, 226, 57,
+248, 184, 159, 2, 27, 130, 0, 194, 74, 68, 169, 19, 14, 146, 57, 179, 82, 219,
+1, 172, 129, 74, 146, 64, 168, 34, 139, 3, 88, 178, 40, 233, 152, 140, 130, 27,
+131, 88, 168, 0, 24, 226, 59, 133, 32, 152, 2, 141, 145, 29, 161, 56, 171, 20,
+90, 5, 40, 144, 35, 25, 19, 82, 186, 219, 173, 255, 26, 160, 34, 40, 134, 26,
+193, 89, 144, 50, 152, 146, 159, 177, 42, 177, 98, 152, 33, 140, 131, 74, 147,
+65, 201, 145, 11, 208, 73, 176, 34, 171, 148, 58, 194, 73, 168, 33, 136, 18, 66,
+186, 32, 188, 171, 9, 41, 23, 49, 2, 5, 140, 19, 115, 131, 82, 154, 224, 155,
+255, 24, 152, 17, 25, 133, 26, 178, 105, 145, 50, 168, 0, 35, 72, 129, 158, 176,
+58, 195, 88, 184, 32, 154, 20, 72, 4, 24, 168, 154, 9, 128, 24, 217, 168, 189,
+152, 89, 19, 16, 234, 43, 7, 24, 3, 8, 208, 154, 27, 5, 42, 132, 40, 178, 43,
+19, 113, 19, 73, 145, 169, 157, 241, 223, 1, 10, 146, 64, 152, 2, 156, 22, 24,
+146, 40, 217, 0, 141, 131, 43, 193, 25, 168, 19, 56, 7, 32, 184, 16, 138, 5, 11,
+164, 141, 200, 41, 152, 33, 171, 67, 10, 19, 100, 144, 18, 172, 0, 56, 232, 64,
+153, 18, 140, 130, 137, 104, 20, 16, 145, 130, 188, 251, 191, 178, 64, 185, 50,
+13, 163, 77, 149, 33, 184, 18, 140, 163, 45, 162, 25, 203, 0, 26, 6, 0, 239, 74,
+56, 178, 17, 153, 20, 41, 4, 139, 219, 152, 139, 162, 28, 241, 13, 18, 32, 19,
+33, 10, 178, 29, 21, 16, 184, 58, 177, 32, 186, 4, 187, 13, 115, 37, 168, 33,
+255, 29, 144, 17, 136, 129, 29, 161, 91, 132, 33, 169, 2, 13, 146, 73, 194, 8,
+219, 2, 27, 4, 42, 161, 24, 10, 39, 40, 177, 9, 186, 16, 137, 1, 251, 191, 24,
+34, 18, 18, 0, 232, 57, 18, 37, 168, 153, 41, 51, 4, 11, 248, 10, 170, 68, 33,
+200, 232, 223, 17, 42, 148, 42, 216, 56, 153, 36, 56, 194, 43, 192, 66, 138, 3,
+13, 192, 42, 145, 67, 170, 130, 11, 3, 56, 52, 130, 188, 184, 48, 136, 135, 207,
+0, 233, 72, 137, 25, 5, 24, 161, 128, 154, 51, 84, 145, 11, 192, 57, 132, 68,
+168, 128, 10, 155, 50, 27, 183, 141, 255, 56, 153, 133, 10, 178, 58, 184, 54,
+26, 148, 44, 176, 80, 169, 19, 140, 161, 44, 161, 50, 169, 130, 45, 179, 112,
+145, 17, 155, 161, 57, 163, 8, 255, 25, 0, 33, 160, 2, 170, 136, 52, 33, 148,
+138, 136, 36, 81, 147, 42, 200, 25, 88, 176, 73, 219, 255, 59, 152, 20, 141,
+146, 43, 178, 114, 144, 132, 11, 163, 73, 160, 34, 174, 146, 28, 179, 88, 152,
+0, 138, 131, 82, 145, 16, 137, 145, 57, 192, 153, 223, 41, 129, 18, 10, 178, 11,
+137, 87, 137, 1, 10, 33, 1, 98, 144, 0, 37, 63, 177, 75, 147, 114, 185, 40, 201,
+255, 41, 152, 131, 12, 179, 59, 168, 70, 9, 147, 59, 179, 64, 154, 21, 142, 160,
+74, 176, 33, 138, 162, 44, 130, 54, 153, 1, 24, 128, 8, 129, 190, 250, 59, 148,
+32, 187, 18, 170, 17, 69, 0, 8, 40, 129, 51, 20, 146, 192, 42, 192, 117, 152, 8,
+172, 255, 40, 152, 132, 12, 179, 59, 152, 69, 10, 179, 91, 161, 48, 154, 5, 141,
+177, 72, 168, 17, 138, 146, 44, 129, 83, 152, 8, 32, 40, 136, 129, 219, 251, 74,
+146, 8, 170, 130, 153, 57, 39, 168, 136, 67, 35, 40, 37, 136, 201, 49, 147, 36,
+141, 139, 170, 255, 47, 138, 164, 43, 211, 40, 153, 23, 0, 17, 81, 26, 178, 73,
+144, 32, 138, 132, 14, 176, 64, 153, 129, 26, 178, 41, 24, 23, 136, 8, 17, 25,
+177, 50, 235, 218, 75, 131, 11, 154, 19, 202, 24, 83, 130, 28, 129, 66, 2, 51,
+8, 145, 59, 194, 71, 153, 176, 172, 255, 58, 28, 211, 42, 193, 16, 26, 7, 41,
+160, 64, 137, 2, 42, 195, 11, 187, 51, 139, 225, 57, 201, 17, 104, 130, 17, 10,
+4, 40, 136, 130, 158, 249, 73, 161, 136, 137, 146, 139, 32, 38, 169, 0, 50, 1,
+53, 32, 161, 28, 136, 17, 135, 144, 217, 241, 207, 2, 74, 200, 32, 170, 147,
+106, 163, 48, 170, 20, 41, 161, 65, 185, 192, 28, 145, 8, 170, 147, 140, 152,
+55, 0, 253, 67, 24, 163, 88, 0, 3, 59, 227, 26, 236, 56, 144, 136, 152, 128,
+184, 40, 37, 177, 89, 130, 81, 129, 49, 161, 8, 33, 60, 50, 177, 143, 249, 239,
+178, 48, 187, 34, 14, 144, 97, 145, 1, 9, 2, 16, 8, 133, 154, 219, 16, 136, 177,
+43, 194, 140, 32, 38, 1, 136, 18, 33, 16, 22, 139, 235, 138, 24, 192, 40, 160,
+186, 170, 100, 128, 17, 56, 150, 89, 147, 65, 152, 146, 121, 160, 16, 152, 160,
+249, 239, 163, 41, 201, 49, 171, 162, 120, 147, 40, 152, 19, 9, 32, 132, 153,
+251, 16, 137, 144, 59, 242, 9, 128, 21, 8, 130, 72, 152, 17, 19, 184, 219, 27,
+8, 188, 57, 162, 208, 203, 68, 0, 251, 61, 160, 33, 72, 134, 59, 3, 48, 154, 20,
+0, 242, 131, 128, 210, 251, 191, 3, 27, 210, 73, 200, 0, 40, 4, 41, 161, 34,
+144, 34, 4, 155, 248, 57, 185, 146, 141, 180, 10, 0, 83, 0, 25, 19, 8, 129, 55,
+168, 201, 59, 185, 161, 159, 3, 217, 42, 0, 17, 45, 132, 50, 8, 53, 128, 152,
+82, 146, 201, 49, 137, 170, 77, 255, 44, 184, 3, 139, 164, 27, 128, 100, 136, 1,
+24, 128, 1, 66, 168, 168, 14, 178, 40, 201, 1, 156, 24, 40, 37, 168, 35, 154, 7,
+72, 148, 9, 203, 16, 138, 146, 156, 145, 174, 130, 32, 195, 88, 146, 65, 40, 37,
+8, 17, 0, 128, 28, 7, 170, 137, 241, 0, 254, 64, 175, 149, 43, 193, 56, 170,
+129, 121, 130, 8, 0, 0, 131, 72, 148, 10, 218, 48, 169, 129, 11, 200, 139, 40,
+22, 40, 161, 34, 9, 132, 103, 168, 8, 155, 128, 58, 162, 168, 220, 10, 2, 16,
+128, 50, 136, 100, 67, 49, 132, 72, 16, 160, 85, 201, 1, 13, 251, 31, 161, 24,
+169, 1, 140, 0, 81, 146, 8, 18, 136, 6, 56, 146, 139, 155, 19, 188, 2, 201, 140,
+202, 81, 128, 16, 4, 26, 130, 73, 38, 144, 10, 248, 58, 177, 16, 153, 173, 10,
+40, 20, 153, 1, 0, 100, 35, 97, 177, 42, 19, 21, 136, 136, 224, 42, 240, 175,
+180, 43, 161, 25, 170, 0, 72, 7, 9, 18, 144, 64, 0, 0, 12, 64, 19, 170, 176, 56,
+217, 73, 169, 170, 187, 41, 134, 11, 53, 145, 43, 21, 49, 6, 171, 130, 158, 9,
+52, 174, 0, 155, 146, 25, 18, 4, 156, 51, 82, 35, 16, 96, 192, 112, 160, 48,
+160, 11, 145, 255, 58, 202, 17, 169, 161, 9, 136, 115, 1, 25, 18, 10, 6, 48,
+130, 153, 12, 179, 27, 164, 202, 156, 176, 59, 132, 26, 134, 138, 67, 48, 52,
+128, 136, 248, 13, 3, 137, 137, 187, 160, 157, 20, 65, 152, 26, 2, 115, 20, 2,
+41, 185, 98, 144, 52, 200, 139, 241, 207, 34, 140, 130, 139, 193, 24, 136, 83,
+136, 40, 146, 73, 4, 48, 1, 176, 29, 179, 12, 163, 171, 217, 154, 8, 16, 34, 0,
+243, 53, 162, 72, 132, 115, 20, 0, 128, 155, 249, 60, 148, 139, 0, 203, 25, 144,
+81, 130, 152, 33, 24, 87, 16, 1, 160, 42, 2, 114, 152, 144, 12, 254, 45, 178,
+25, 161, 10, 154, 128, 88, 3, 8, 49, 177, 114, 148, 82, 152, 152, 41, 208, 56,
+168, 168, 156, 202, 34, 9, 5, 10, 16, 33, 82, 20, 129, 153, 184, 155, 190, 84,
+232, 24, 169, 24, 153, 50, 0, 17, 57, 37, 65, 37, 129, 2, 187, 70, 152, 33, 170,
+8, 255, 31, 161, 26, 178, 9, 171, 17, 59, 7, 24, 0, 145, 80, 2, 80, 144, 9, 128,
+169, 81, 184, 137, 203, 139, 35, 170, 4, 26, 185, 114, 21, 19, 137, 18, 189, 64,
+251, 0, 249, 64, 48, 177, 10, 144, 170, 9, 65, 2, 34, 137, 23, 65, 37, 1, 136,
+24, 4, 16, 135, 138, 176, 250, 223, 34, 187, 18, 171, 168, 10, 176, 86, 152, 16,
+129, 26, 23, 0, 18, 9, 0, 8, 24, 146, 170, 175, 40, 171, 18, 174, 19, 189, 50,
+2, 81, 136, 1, 137, 176, 112, 224, 57, 179, 141, 130, 10, 132, 139, 3, 33, 8,
+68, 19, 148, 49, 168, 69, 25, 148, 0, 192, 241, 255, 18, 170, 17, 170, 152, 154,
+16, 34, 145, 32, 145, 42, 119, 0, 19, 137, 33, 24, 136, 51, 249, 11, 152, 9,
+144, 156, 152, 143, 1, 32, 34, 152, 57, 177, 9, 139, 87, 13, 5, 156, 1, 152, 34,
+152, 48, 144, 0, 5, 50, 98, 145, 50, 34, 8, 49, 131, 4, 65, 233, 57, 255, 31,
+176, 24, 192, 137, 168, 9, 50, 176, 56, 0, 35, 113, 7, 40, 162, 48, 130, 17, 0,
+208, 10, 208, 24, 136, 217, 26, 249, 41, 129, 24, 24, 1, 136, 202, 81, 3, 157,
+53, 186, 57, 16, 0, 156, 80, 130, 138, 84, 145, 42, 130, 67, 195, 82, 0, 25, 10,
+255, 47, 177, 43, 178, 155, 136, 169, 65, 161, 40, 129, 8, 114, 6, 32, 144, 50,
+144, 66, 1, 176, 140, 168, 56, 169, 202, 159, 176, 43, 147, 48, 176, 139, 114,
+151, 25, 161, 72, 176, 121, 162, 139, 2, 187, 36, 9, 148, 154, 50, 52, 136, 66,
+37, 171, 86, 136, 16, 169, 0, 27, 54, 255, 73, 184, 41, 176, 156, 136, 128, 40,
+160, 56, 19, 25, 117, 1, 48, 17, 16, 67, 161, 81, 208, 138, 129, 9, 169, 219,
+154, 154, 170, 98, 216, 48, 161, 57, 7, 136, 34, 173, 37, 202, 49, 177, 25, 153,
+9, 9, 177, 81, 148, 72, 129, 33, 49, 71, 128, 33, 153, 1, 18, 255, 47, 177, 28,
+145, 155, 168, 152, 48, 176, 73, 146, 57, 68, 38, 136, 18, 49, 2, 34, 35, 250,
+28, 128, 137, 187, 168, 175, 136, 152, 25, 0, 88, 160, 89, 36, 16, 2, 128, 218,
+104, 178, 45, 162, 143, 129, 10, 18, 154, 17, 17, 8, 86, 1, 8, 38, 168, 51, 161,
+56, 177, 43, 255, 47, 192, 25, 160, 139, 0, 216, 66, 137, 16, 8, 24, 2, 41, 22,
+96, 3, 56, 145, 48, 130, 24, 34, 250, 171, 201, 10, 8, 235, 9, 202, 24, 51, 2,
+99, 184, 96, 19, 1, 17, 152, 49, 220, 140, 145, 190, 2, 251, 56, 160, 26, 131,
+41, 50, 51, 116, 18, 32, 18, 17, 36, 1, 193, 66, 249, 188, 191, 34, 173, 32,
+201, 154, 24, 129, 16, 34, 145, 97, 130, 100, 0, 32, 136, 0, 8, 16, 201, 171,
+184, 172, 200, 9, 201, 59, 179, 121, 21, 0, 1, 50, 34, 82, 144, 34, 140, 169,
+140, 250, 189, 138, 147, 158, 1, 203, 33, 128, 53, 129, 50, 34, 52, 53, 18, 40,
+133, 59, 38, 216, 25, 160, 221, 158, 18, 203, 17, 187, 0, 208, 65, 136, 137, 2,
+35, 9, 38, 129, 34, 71, 128, 16, 136, 18, 169, 1, 217, 188, 9, 153, 185, 40,
+235, 48, 145, 100, 128, 33, 52, 8, 53, 153, 16, 138, 170, 128, 223, 136, 202,
+153, 237, 89, 176, 58, 163, 43, 21, 25, 50, 24, 19, 68, 1, 66, 161, 9, 146, 56,
+243, 28, 176, 142, 251, 44, 177, 43, 210, 10, 152, 33, 24, 36, 137, 36, 16, 115,
+146, 40, 161, 41, 177, 24, 202, 170, 191, 136, 136, 17, 200, 9, 129, 101, 17,
+18, 24, 160, 114, 130, 136, 170, 152, 157, 145, 140, 240, 139, 128, 251, 106,
+146, 43, 132, 139, 83, 128, 32, 17, 152, 34, 24, 22, 169, 41, 164, 14, 132, 171,
+16, 176, 0, 19, 57, 238, 27, 146, 30, 146, 140, 145, 24, 0, 35, 8, 50, 0, 114,
+5, 25, 129, 138, 145, 41, 177, 173, 188, 152, 140, 18, 146, 171, 39, 10, 53, 1,
+34, 16, 1, 64, 144, 10, 233, 173, 128, 219, 168, 169, 157, 192, 31, 6, 9, 1,
+153, 49, 5, 24, 17, 176, 88, 129, 33, 145, 10, 193, 9, 217, 97, 168, 170, 171,
+255, 75, 177, 41, 200, 8, 11, 21, 41, 148, 41, 146, 81, 3, 2, 153, 144, 9, 154,
+3, 207, 185, 12, 145, 25, 2, 144, 56, 21, 114, 19, 33, 9, 149, 74, 164, 28, 176,
+156, 137, 152, 173, 169, 221, 80, 162, 41, 147, 153, 65, 52, 17, 17, 169, 32,
+49, 23, 153, 136, 218, 0, 18, 56, 56, 148, 27, 184, 158, 25, 241, 191, 3, 156,
+131, 12, 161, 72, 176, 84, 168, 50, 168, 51, 1, 128, 17, 217, 11, 184, 170, 160,
+191, 40, 171, 82, 0, 128, 97, 17, 53, 17, 1, 24, 129, 152, 152, 219, 190, 203,
+138, 250, 137, 188, 67, 136, 66, 128, 25, 100, 1, 34, 130, 153, 4, 24, 21, 138,
+152, 171, 41, 33, 179, 239, 176, 43, 241, 175, 3, 141, 146, 10, 144, 64, 184,
+84, 152, 34, 137, 36, 25, 145, 73, 216, 41, 168, 128, 187, 201, 56, 185, 36,
+128, 4, 64, 130, 115, 129, 33, 130, 144, 168, 186, 201, 221, 155, 169, 206, 152,
+57, 134, 28, 3, 41, 18, 67, 2, 50, 152, 99, 146, 33, 0, 32, 52, 128, 137, 24,
+251, 50, 174, 20, 173, 128, 154, 255, 40, 200, 32, 184, 24, 139, 4, 58, 7, 25,
+146, 72, 146, 33, 152, 1, 174, 3, 154, 160, 155, 172, 24, 139, 39, 0, 128, 33,
+48, 54, 129, 17, 3, 203, 0, 169, 206, 140, 233, 11, 152, 16, 168, 50, 160, 115,
+35, 35, 66, 1, 80, 20, 33, 144, 17, 138, 17, 41, 200, 156, 250, 33, 184, 250,
+255, 26, 153, 17, 169, 168, 11, 4, 97, 131, 56, 161, 81, 1, 51, 137, 177, 159,
+129, 136, 169, 169, 220, 0, 136, 37, 128, 16, 17, 98, 35, 24, 3, 156, 8, 153,
+145, 238, 187, 186, 220, 88, 163, 28, 131, 43, 20, 34, 17, 37, 153, 33, 32, 0,
+24, 52, 53, 152, 24, 169, 26, 148, 48, 241, 172, 18, 159, 208, 223, 33, 170, 33,
+170, 128, 27, 149, 104, 147, 58, 162, 88, 146, 17, 8, 178, 159, 2, 138, 145,
+154, 171, 34, 155, 39, 136, 1, 64, 4, 51, 169, 17, 187, 48, 24, 251, 15, 251,
+10, 129, 24, 130, 137, 8, 51, 52, 51, 50, 145, 122, 52, 8, 65, 129, 138, 20,
+202, 1, 25, 226, 13, 178, 175, 253, 41, 177, 58, 176, 26, 169, 52, 42, 55, 10,
+132, 41, 132, 48, 177, 16, 220, 32, 169, 0, 171, 218, 41, 144, 98, 145, 24, 16,
+51, 67, 129, 33, 193, 169, 16, 201, 175, 189, 155, 169, 137, 82, 161, 40, 131,
+97, 37, 18, 49, 3, 10, 0, 17, 49, 39, 32, 19, 141, 2, 171, 35, 220, 50, 217,
+248, 26, 248, 143, 147, 11, 147, 11, 161, 104, 160, 99, 184, 66, 169, 51, 152,
+130, 58, 248, 41, 177, 25, 184, 153, 26, 178, 121, 132, 25, 128, 17, 64, 5, 138,
+2, 11, 184, 24, 203, 221, 140, 128, 26, 163, 27, 149, 56, 131, 115, 146, 66,
+128, 65, 130, 33, 34, 152, 8, 161, 130, 194, 120, 212, 140, 184, 204, 239, 32,
+200, 32, 185, 32, 154, 4, 73, 134, 25, 163, 73, 147, 40, 161, 145, 157, 131,
+141, 146, 12, 168, 24, 144, 52, 154, 20, 11, 53, 32, 129, 16, 186, 0, 203, 139,
+236, 191, 41, 161, 9, 18, 160, 88, 131, 96, 4, 41, 2, 57, 0, 15, 54, 39, 137,
+34, 136, 8, 33, 233, 64, 170, 18, 189, 153, 170, 255, 47, 192, 40, 176, 40, 169,
+34, 41, 23, 26, 148, 42, 133, 24, 161, 17, 204, 33, 186, 33, 203, 8, 26, 0, 65,
+168, 67, 184, 52, 33, 3, 32, 242, 26, 176, 27, 249, 156, 170, 25, 153, 56, 4,
+152, 49, 100, 17, 49, 6, 8, 34, 33, 35, 35, 152, 1, 190, 37, 187, 22, 174, 160,
+11, 254, 47, 161, 42, 194, 25, 160, 64, 153, 23, 153, 4, 138, 4, 25, 129, 41,
+217, 40, 168, 16, 186, 152, 26, 161, 121, 163, 32, 136, 34, 64, 133, 26, 163,
+12, 145, 139, 185, 191, 138, 234, 10, 50, 160, 64, 145, 89, 21, 25, 21, 8, 0,
+12, 59, 1, 32, 34, 22, 155, 36, 172, 33, 136, 17, 176, 205, 187, 194, 255, 58,
+218, 33, 201, 1, 138, 133, 57, 150, 41, 163, 90, 145, 48, 153, 2, 158, 2, 12,
+146, 155, 144, 25, 152, 68, 152, 34, 137, 50, 99, 162, 48, 233, 32, 201, 144,
+155, 248, 11, 233, 72, 177, 40, 145, 0, 49, 133, 65, 146, 25, 33, 35, 48, 4, 32,
+194, 26, 132, 8, 153, 192, 191, 169, 174, 255, 42, 192, 56, 200, 24, 153, 35,
+58, 39, 42, 147, 60, 132, 56, 160, 33, 191, 18, 156, 2, 155, 161, 43, 177, 113,
+162, 50, 160, 50, 17, 50, 35, 251, 10, 201, 8, 186, 234, 157, 200, 43, 133, 42,
+132, 10, 19, 33, 83, 0, 8, 58, 18, 136, 34, 145, 86, 160, 32, 146, 156, 32, 177,
+41, 201, 9, 237, 169, 255, 9, 145, 138, 146, 10, 184, 97, 136, 70, 152, 33, 26,
+18, 56, 195, 41, 233, 41, 185, 32, 203, 8, 155, 130, 89, 6, 40, 131, 40, 35, 49,
+16, 131, 157, 234, 139, 185, 170, 174, 249, 29, 163, 31, 19, 138, 18, 128, 8,
+53, 169, 68, 168, 32, 144, 48, 131, 25, 152, 203, 59, 166, 27, 211, 189, 137,
+254, 44, 162, 44, 162, 26, 168, 82, 154, 55, 138, 34, 10, 3, 41, 195, 73, 233,
+40, 201, 17, 169, 128, 138, 162, 106, 147, 80, 161, 48, 8, 21, 10, 3, 140, 176,
+155, 200, 171, 171, 217, 139, 241, 27, 22, 128, 0, 237, 61, 33, 1, 40, 52, 1,
+69, 177, 9, 130, 57, 5, 25, 129, 173, 9, 128, 16, 233, 194, 175, 240, 143, 2,
+11, 130, 11, 178, 106, 177, 114, 161, 48, 168, 50, 138, 4, 27, 210, 27, 193, 42,
+176, 25, 187, 19, 28, 39, 42, 132, 57, 162, 65, 145, 65, 202, 136, 219, 152,
+138, 170, 24, 207, 8, 16, 17, 49, 35, 49, 21, 50, 21, 17, 145, 41, 152, 64, 131,
+1, 158, 145, 144, 202, 89, 148, 172, 234, 137, 255, 44, 161, 59, 177, 42, 200,
+51, 155, 119, 137, 2, 9, 2, 41, 129, 32, 250, 25, 185, 24, 137, 128, 140, 146,
+75, 132, 81, 130, 48, 144, 51, 155, 23, 186, 144, 173, 169, 139, 184, 186, 0,
+233, 51, 156, 162, 61, 39, 40, 50, 50, 136, 84, 152, 68, 168, 24, 153, 32, 136,
+153, 144, 249, 138, 20, 18, 184, 184, 239, 208, 175, 18, 155, 2, 139, 177, 91,
+194, 113, 147, 32, 144, 49, 137, 20, 24, 194, 142, 144, 155, 128, 8, 169, 0,
+169, 54, 0, 53, 1, 18, 24, 146, 82, 192, 139, 154, 221, 155, 137, 186, 154, 252,
+48, 131, 104, 4, 16, 24, 2, 56, 20, 8, 161, 152, 170, 49, 154, 33, 175, 185, 28,
+69, 34, 216, 154, 186, 254, 143, 130, 12, 130, 138, 161, 57, 160, 102, 144, 33,
+136, 2, 8, 130, 73, 226, 11, 193, 11, 161, 24, 152, 1, 155, 22, 41, 38, 32, 1,
+16, 152, 18, 203, 3, 0, 20, 50, 221, 170, 171, 187, 40, 233, 26, 192, 74, 22,
+33, 51, 3, 26, 19, 59, 39, 138, 0, 137, 138, 17, 41, 193, 188, 137, 21, 120,
+150, 138, 153, 253, 158, 1, 138, 17, 138, 176, 25, 152, 103, 128, 34, 136, 1, 8,
+3, 72, 210, 11, 201, 139, 169, 17, 152, 130, 142, 19, 75, 23, 33, 131, 40, 144,
+32, 201, 1, 235, 186, 157, 184, 27, 185, 73, 250, 41, 16, 52, 81, 35, 136, 16,
+136, 40, 4, 144, 128, 185, 25, 80, 129, 43, 36, 8, 8, 119, 179, 168, 171, 255,
+143, 145, 26, 145, 25, 185, 33, 155, 103, 8, 19, 137, 2, 25, 146, 64, 216, 9,
+219, 137, 138, 1, 9, 145, 41, 147, 113, 22, 0, 6, 63, 33, 1, 17, 169, 34, 155,
+19, 223, 169, 187, 169, 8, 184, 57, 249, 13, 35, 18, 69, 3, 8, 129, 138, 4, 154,
+4, 137, 186, 112, 152, 64, 146, 26, 36, 9, 85, 160, 128, 187, 250, 239, 129,
+138, 130, 10, 176, 57, 184, 116, 146, 67, 144, 1, 9, 2, 58, 195, 29, 216, 139,
+168, 41, 153, 17, 25, 19, 107, 38, 48, 35, 32, 161, 41, 202, 18, 205, 152, 175,
+153, 153, 186, 33, 234, 17, 10, 53, 64, 19, 64, 162, 8, 147, 153, 18, 11, 152,
+40, 48, 118, 16, 16, 25, 19, 67, 23, 25, 200, 159, 252, 11, 176, 26, 145, 41,
+203, 33, 11, 119, 24, 18, 136, 129, 25, 145, 65, 216, 8, 218, 0, 248, 65, 138,
+136, 136, 32, 144, 41, 129, 116, 33, 67, 1, 130, 10, 162, 13, 163, 142, 200,
+154, 203, 136, 169, 0, 27, 160, 77, 37, 40, 21, 32, 128, 57, 195, 73, 146, 57,
+160, 32, 147, 114, 131, 40, 3, 42, 38, 9, 129, 224, 222, 220, 155, 176, 139,
+145, 24, 186, 64, 140, 71, 16, 36, 24, 130, 26, 146, 72, 178, 58, 250, 156, 168,
+26, 136, 18, 25, 51, 138, 71, 2, 36, 35, 0, 152, 171, 168, 170, 236, 186, 205,
+170, 186, 136, 25, 144, 130, 142, 71, 128, 50, 20, 0, 16, 145, 33, 132, 25, 6,
+11, 49, 153, 17, 52, 156, 83, 169, 19, 233, 219, 205, 189, 136, 187, 16, 153,
+144, 14, 160, 112, 0, 218, 62, 19, 66, 3, 17, 0, 32, 25, 52, 153, 161, 222, 169,
+154, 136, 17, 24, 8, 10, 18, 114, 37, 35, 51, 144, 128, 169, 10, 232, 169, 252,
+186, 219, 152, 10, 160, 139, 187, 116, 146, 82, 2, 50, 0, 51, 82, 131, 9, 1, 28,
+128, 112, 147, 9, 8, 40, 176, 96, 35, 10, 207, 236, 173, 9, 186, 17, 170, 161,
+172, 152, 89, 22, 64, 19, 32, 130, 40, 19, 67, 128, 2, 204, 172, 171, 170, 24,
+144, 138, 160, 14, 17, 34, 87, 51, 16, 1, 128, 128, 128, 10, 184, 223, 202, 187,
+203, 25, 218, 24, 234, 81, 161, 56, 34, 32, 65, 4, 48, 5, 10, 34, 8, 33, 52, 32,
+88, 201, 16, 1, 56, 0, 22, 40, 131, 203, 251, 252, 175, 8, 171, 0, 153, 168,
+137, 219, 73, 3, 114, 19, 33, 17, 2, 41, 5, 32, 19, 154, 219, 186, 157, 154, 10,
+8, 129, 188, 16, 10, 114, 22, 33, 18, 129, 128, 130, 42, 3, 159, 200, 187, 219,
+185, 201, 153, 236, 56, 146, 57, 17, 32, 130, 22, 99, 51, 49, 65, 8, 1, 40, 39,
+16, 33, 8, 186, 128, 11, 140, 128, 255, 186, 207, 138, 170, 137, 144, 128, 203,
+169, 138, 53, 66, 52, 36, 1, 18, 17, 51, 52, 97, 18, 185, 185, 202, 154, 10, 8,
+131, 184, 189, 203, 128, 132, 84, 34, 130, 8, 139, 12, 200, 128, 128, 224, 187,
+203, 248, 10, 210, 43, 241, 57, 163, 73, 0, 250, 48, 145, 25, 18, 21, 33, 38, 9,
+131, 128, 83, 33, 1, 21, 128, 128, 128, 11, 8, 216, 200, 192, 190, 223, 153,
+169, 153, 144, 152, 234, 176, 140, 1, 9, 36, 51, 65, 19, 34, 68, 49, 84, 33, 48,
+1, 152, 42, 187, 128, 128, 181, 139, 252, 156, 128, 137, 32, 8, 139, 132, 0,
+136, 0, 6, 140, 64, 184, 200, 188, 192, 176, 175, 20, 169, 34, 8, 8, 3, 4, 116,
+40, 40, 21, 40, 8, 2, 8, 3, 8, 96, 131, 0, 88, 64, 72, 72, 56, 139, 244, 174,
+168, 203, 137, 156, 169, 171, 158, 170, 137, 160, 64, 65, 17, 20, 36, 18, 66,
+21, 48, 35, 1, 130, 11, 3, 140, 132, 128, 4, 8, 0, 6, 35, 64, 128, 128, 14, 72,
+203, 176, 140, 187, 188, 200, 203, 176, 200, 3, 8, 8, 54, 12, 67, 184, 52, 136,
+0, 136, 0, 136, 240, 9, 8, 120, 3, 52, 64, 38, 40, 5, 33, 2, 37, 8, 56, 184,
+132, 187, 60, 239, 170, 202, 154, 186, 155, 202, 155, 218, 11, 168, 32, 42, 23,
+16, 21, 40, 1, 82, 35, 33, 22, 17, 66, 128, 52, 32, 4, 33, 32, 179, 192, 184, 8,
+189, 8, 189, 187, 200, 236, 8, 152, 184, 128, 139, 12, 200, 200, 128, 188, 72,
+192, 11, 8, 8, 128, 112, 3, 52, 3, 55, 88, 18, 34, 50, 72, 50, 128, 64, 179, 88,
+184, 88, 11, 195, 139, 192, 188, 251, 186, 172, 201, 0, 252, 45, 171, 170, 189,
+154, 189, 171, 137, 138, 128, 128, 80, 120, 18, 82, 19, 20, 53, 81, 33, 50, 17,
+67, 33, 33, 8, 162, 72, 184, 192, 172, 139, 223, 152, 169, 154, 157, 185, 156,
+139, 156, 168, 170, 32, 187, 88, 131, 48, 53, 72, 51, 3, 64, 39, 32, 50, 99, 34,
+34, 56, 115, 18, 128, 38, 16, 32, 8, 56, 8, 200, 188, 251, 205, 169, 202, 171,
+188, 187, 172, 234, 170, 168, 10, 42, 72, 33, 67, 48, 55, 65, 66, 51, 51, 53,
+33, 51, 18, 18, 34, 35, 192, 176, 240, 154, 173, 157, 170, 187, 173, 169, 203,
+170, 153, 170, 168, 139, 192, 139, 4, 175, 52, 10, 132, 32, 34, 99, 40, 66, 68,
+0, 1, 48, 2, 68, 17, 51, 51, 18, 53, 35, 130, 32, 51, 172, 200, 190, 200, 255,
+152, 169, 169, 187, 185, 188, 203, 140, 152, 10, 9, 51, 65, 37, 98, 18, 67, 34,
+67, 36, 35, 50, 18, 82, 8, 1, 9, 152, 10, 219, 156, 203, 219, 187, 186, 158,
+187, 184, 187, 156, 154, 170, 186, 187, 64, 248, 65, 72, 129, 18, 34, 53, 34,
+36, 54, 35, 83, 36, 51, 50, 49, 52, 19, 128, 35, 3, 188, 240, 206, 219, 169,
+188, 170, 172, 202, 186, 204, 153, 168, 137, 1, 50, 50, 38, 83, 51, 65, 36, 67,
+51, 67, 50, 35, 34, 128, 3, 10, 178, 48, 175, 201, 220, 170, 172, 187, 172, 187,
+172, 201, 154, 185, 137, 0, 235, 43, 156, 200, 72, 160, 32, 54, 24, 148, 113,
+17, 33, 33, 22, 18, 66, 34, 36, 18, 50, 51, 130, 32, 22, 137, 162, 175, 238,
+138, 201, 138, 188, 136, 157, 185, 155, 168, 10, 154, 37, 18, 36, 113, 3, 48,
+18, 36, 51, 37, 49, 20, 49, 128, 48, 137, 3, 31, 178, 136, 249, 168, 155, 217,
+157, 168, 139, 186, 170, 155, 192, 155, 170, 76, 195, 25, 18, 7, 32, 145, 53,
+56, 132, 83, 2, 21, 49, 51, 20, 3, 51, 21, 57, 163, 132, 137, 242, 187, 239,
+136, 187, 200, 138, 185, 172, 186, 138, 170, 169, 72, 20, 88, 35, 115, 16, 34,
+49, 20, 82, 18, 51, 49, 19, 128, 131, 32, 168, 56, 251, 145, 0, 28, 43, 175,
+184, 143, 201, 138, 170, 152, 172, 160, 154, 176, 156, 145, 128, 8, 128, 115,
+151, 56, 0, 20, 56, 34, 39, 40, 19, 84, 32, 4, 32, 34, 131, 48, 3, 33, 10, 248,
+239, 10, 201, 154, 172, 136, 188, 202, 137, 169, 153, 137, 17, 17, 51, 114, 7,
+48, 1, 51, 64, 20, 50, 21, 50, 128, 34, 17, 131, 27, 149, 42, 190, 128, 174,
+168, 143, 169, 153, 185, 10, 156, 161, 171, 176, 10, 42, 232, 80, 17, 179, 72,
+16, 7, 16, 33, 23, 56, 131, 115, 1, 19, 32, 18, 50, 17, 52, 152, 6, 142, 250,
+26, 233, 136, 156, 145, 156, 185, 25, 201, 136, 137, 2, 74, 147, 113, 1, 65,
+128, 35, 81, 0, 250, 56, 3, 82, 17, 51, 25, 2, 32, 148, 25, 194, 33, 204, 169,
+187, 233, 156, 203, 138, 200, 170, 154, 177, 11, 220, 129, 25, 177, 88, 5, 144,
+16, 40, 52, 130, 82, 21, 97, 16, 50, 17, 68, 129, 64, 0, 20, 72, 145, 50, 219,
+253, 58, 233, 136, 170, 129, 172, 202, 24, 185, 10, 152, 4, 43, 134, 88, 129,
+51, 8, 20, 80, 131, 66, 18, 35, 136, 3, 73, 162, 57, 154, 150, 142, 177, 139,
+250, 137, 171, 200, 11, 184, 137, 155, 8, 175, 130, 27, 147, 38, 10, 6, 58, 160,
+81, 32, 18, 1, 67, 19, 52, 65, 51, 52, 40, 1, 85, 145, 35, 160, 148, 204, 239,
+16, 187, 144, 157, 178, 156, 202, 0, 221, 59, 32, 187, 128, 58, 178, 113, 136,
+66, 33, 132, 72, 18, 82, 129, 82, 17, 2, 24, 132, 56, 184, 65, 13, 161, 29, 192,
+10, 202, 153, 172, 176, 139, 192, 138, 170, 160, 44, 193, 128, 32, 21, 160, 100,
+136, 5, 42, 194, 115, 137, 132, 57, 161, 20, 42, 148, 66, 9, 20, 24, 32, 177,
+72, 129, 203, 251, 31, 193, 10, 171, 128, 157, 201, 8, 169, 137, 8, 18, 42, 6,
+40, 5, 66, 0, 21, 48, 4, 48, 18, 36, 136, 5, 56, 192, 48, 170, 148, 142, 160,
+154, 187, 201, 172, 186, 170, 158, 153, 153, 160, 27, 162, 128, 128, 7, 64, 18,
+21, 50, 128, 37, 113, 137, 64, 32, 144, 35, 40, 23, 24, 0, 13, 47, 17, 20, 129,
+64, 65, 128, 90, 184, 18, 158, 252, 75, 232, 24, 171, 129, 155, 217, 41, 184,
+128, 26, 164, 105, 128, 48, 2, 133, 64, 130, 98, 129, 49, 32, 4, 41, 129, 82,
+168, 16, 10, 210, 14, 168, 137, 188, 176, 142, 169, 9, 156, 136, 25, 185, 137,
+56, 130, 3, 23, 32, 210, 115, 177, 20, 41, 146, 36, 75, 5, 128, 0, 147, 17, 42,
+7, 40, 0, 163, 90, 177, 18, 140, 194, 72, 201, 255, 32, 187, 144, 28, 208, 128,
+187, 0, 10, 154, 80, 168, 52, 138, 36, 112, 145, 66, 128, 21, 40, 1, 81, 144,
+17, 24, 16, 16, 187, 40, 250, 155, 186, 156, 187, 219, 171, 201, 186, 10, 170,
+56, 0, 241, 39, 187, 132, 128, 64, 72, 84, 66, 33, 132, 64, 147, 88, 17, 22,
+153, 20, 129, 128, 128, 2, 8, 23, 128, 64, 162, 56, 235, 21, 170, 18, 128, 255,
+140, 162, 140, 128, 26, 155, 225, 12, 145, 24, 137, 3, 59, 133, 17, 40, 39, 42,
+6, 57, 147, 34, 24, 23, 16, 144, 34, 144, 184, 25, 10, 207, 137, 218, 128, 156,
+156, 136, 156, 178, 9, 16, 8, 14, 20, 154, 34, 106, 130, 90, 4, 8, 32, 145, 120,
+130, 16, 130, 169, 5, 138, 57, 35, 168, 114, 195, 42, 145, 43, 39, 186, 37, 153,
+255, 42, 201, 24, 144, 128, 24, 250, 58, 168, 1, 40, 146, 80, 168, 0, 48, 7, 24,
+35, 17, 19, 0, 0, 8, 47, 84, 18, 18, 82, 160, 168, 186, 251, 26, 170, 154, 204,
+168, 154, 220, 136, 0, 160, 8, 17, 137, 186, 14, 10, 39, 64, 34, 146, 121, 144,
+38, 40, 1, 33, 14, 145, 48, 144, 3, 57, 29, 6, 186, 32, 178, 120, 144, 154, 72,
+252, 143, 128, 139, 19, 138, 144, 160, 142, 2, 40, 16, 147, 9, 160, 8, 98, 98,
+16, 18, 41, 5, 17, 82, 51, 2, 137, 224, 27, 171, 136, 30, 185, 155, 200, 155,
+153, 16, 40, 250, 24, 142, 162, 25, 251, 57, 163, 62, 5, 25, 2, 131, 104, 2,
+145, 57, 224, 1, 24, 0, 20, 26, 9, 135, 11, 130, 129, 77, 210, 129, 26, 240,
+175, 24, 169, 33, 152, 178, 57, 0, 234, 56, 251, 49, 129, 2, 145, 172, 73, 168,
+64, 35, 148, 16, 1, 83, 82, 0, 53, 152, 154, 137, 155, 176, 10, 216, 141, 138,
+139, 17, 153, 8, 168, 173, 130, 218, 8, 223, 141, 66, 139, 22, 136, 161, 52, 9,
+52, 145, 9, 224, 40, 25, 17, 72, 144, 168, 38, 8, 2, 25, 158, 3, 178, 76, 194,
+175, 191, 33, 170, 19, 136, 192, 57, 201, 113, 128, 129, 153, 139, 33, 8, 32, 6,
+144, 17, 48, 85, 2, 1, 3, 185, 11, 24, 141, 242, 139, 176, 137, 42, 149, 40,
+168, 192, 105, 140, 130, 155, 249, 47, 146, 41, 129, 16, 26, 7, 40, 130, 144, 1,
+188, 18, 66, 8, 129, 203, 36, 193, 81, 146, 153, 0, 21, 53, 41, 12, 65, 154, 5,
+249, 223, 24, 161, 56, 128, 136, 13, 131, 58, 132, 16, 186, 186, 25, 5, 145, 50,
+169, 96, 40, 39, 24, 132, 26, 2, 9, 9, 160, 253, 8, 160, 57, 152, 8, 43, 165,
+57, 192, 24, 202, 239, 24, 147, 129, 41, 136, 105, 128, 35, 128, 4, 24, 154,
+112, 128, 152, 129, 3, 16, 59, 51, 159, 36, 200, 17, 185, 248, 106, 161, 153,
+255, 24, 136, 0, 16, 184, 56, 178, 64, 130, 138, 169, 140, 48, 23, 153, 130, 58,
+37, 49, 34, 130, 200, 49, 19, 24, 221, 10, 234, 8, 35, 241, 8, 152, 136, 122,
+177, 155, 143, 18, 10, 4, 137, 168, 36, 169, 37, 153, 0, 153, 98, 19, 0, 16, 57,
+136, 65, 178, 75, 162, 89, 9, 153, 140, 2, 51, 240, 8, 163, 253, 159, 8, 0, 0,
+144, 170, 35, 145, 36, 152, 137, 156, 137, 54, 177, 128, 24, 113, 50, 32, 66,
+177, 137, 4, 35, 176, 191, 43, 232, 88, 177, 42, 8, 224, 10, 242, 60, 131, 26,
+8, 160, 90, 150, 10, 2, 140, 32, 33, 2, 19, 169, 53, 141, 50, 141, 145, 144,
+234, 36, 154, 128, 27, 146, 233, 191, 32, 136, 16, 153, 185, 50, 193, 65, 144,
+24, 173, 33, 54, 194, 41, 17, 89, 33, 3, 136, 193, 187, 115, 17, 168, 186, 251,
+48, 160, 35, 158, 161, 9, 252, 56, 145, 66, 136, 168, 41, 131, 40, 136, 36, 153,
+114, 36, 2, 0, 27, 55, 1, 218, 26, 18, 4, 0, 240, 44, 18, 88, 128, 254, 157, 1,
+128, 1, 152, 155, 67, 24, 34, 186, 202, 9, 50, 5, 153, 24, 24, 115, 21, 1, 128,
+153, 48, 83, 1, 156, 156, 24, 8, 161, 170, 218, 168, 206, 9, 83, 176, 140, 16,
+8, 36, 184, 8, 8, 24, 38, 50, 7, 128, 80, 130, 75, 133, 155, 144, 40, 1, 32,
+186, 32, 18, 243, 255, 15, 128, 0, 136, 168, 49, 168, 34, 153, 168, 137, 27, 71,
+152, 40, 145, 73, 37, 34, 33, 178, 28, 129, 34, 154, 234, 155, 25, 3, 219, 156,
+200, 141, 137, 68, 185, 153, 75, 146, 99, 185, 128, 88, 130, 66, 0, 37, 152, 33,
+129, 83, 154, 2, 0, 35, 52, 12, 37, 169, 25, 33, 255, 207, 1, 40, 144, 136, 12,
+3, 26, 4, 153, 187, 136, 48, 4, 8, 132, 141, 82, 67, 0, 2, 139, 20, 40, 2, 201,
+173, 153, 17, 33, 233, 9, 188, 184, 91, 6, 137, 171, 40, 56, 21, 138, 9, 129,
+97, 146, 66, 2, 32, 1, 129, 64, 33, 129, 123, 134, 27, 34, 242, 255, 27, 0, 129,
+24, 217, 49, 168, 36, 136, 202, 25, 169, 67, 8, 2, 186, 48, 103, 129, 17, 152,
+25, 8, 19, 160, 206, 9, 40, 129, 137, 136, 240, 157, 40, 51, 170, 188, 40, 24,
+18, 65, 161, 201, 72, 6, 67, 128, 0, 56, 169, 71, 168, 17, 41, 18, 13, 51, 179,
+255, 175, 129, 17, 0, 245, 73, 137, 176, 91, 162, 105, 145, 152, 138, 160, 40,
+18, 1, 1, 159, 68, 17, 2, 0, 170, 34, 11, 50, 248, 172, 0, 24, 24, 1, 145, 254,
+12, 34, 145, 136, 202, 16, 18, 136, 1, 203, 35, 67, 81, 52, 10, 195, 43, 22, 0,
+16, 233, 33, 0, 67, 24, 255, 15, 128, 1, 25, 185, 104, 168, 35, 152, 176, 43,
+186, 98, 144, 17, 184, 42, 54, 35, 16, 201, 42, 147, 0, 128, 249, 141, 10, 50,
+136, 136, 18, 220, 153, 40, 21, 161, 169, 139, 33, 64, 147, 1, 8, 96, 83, 51, 4,
+146, 191, 49, 17, 3, 168, 45, 211, 59, 180, 255, 142, 130, 40, 144, 128, 10,
+149, 57, 132, 137, 170, 168, 41, 0, 214, 63, 21, 25, 128, 137, 83, 22, 33, 1,
+186, 10, 19, 136, 251, 156, 138, 3, 1, 8, 0, 140, 207, 10, 35, 20, 153, 186, 28,
+66, 130, 57, 5, 154, 22, 33, 131, 96, 185, 57, 128, 52, 164, 138, 240, 40, 169,
+248, 223, 1, 24, 145, 32, 202, 35, 140, 6, 9, 160, 25, 155, 51, 137, 147, 138,
+16, 119, 0, 1, 137, 136, 0, 16, 170, 234, 11, 145, 96, 129, 129, 155, 178, 157,
+185, 97, 128, 169, 8, 8, 37, 41, 132, 26, 128, 85, 144, 65, 145, 10, 129, 115,
+161, 32, 137, 212, 13, 130, 235, 207, 33, 136, 2, 138, 161, 80, 160, 66, 185,
+128, 141, 17, 64, 176, 16, 188, 68, 49, 3, 16, 217, 0, 23, 66, 8, 41, 3, 185,
+222, 136, 10, 21, 8, 160, 152, 9, 193, 142, 128, 16, 17, 161, 88, 128, 67, 186,
+34, 90, 20, 25, 3, 16, 23, 138, 18, 27, 147, 123, 164, 141, 152, 171, 251, 191,
+19, 40, 208, 24, 136, 20, 11, 134, 10, 177, 40, 136, 36, 140, 145, 27, 23, 49,
+146, 25, 201, 66, 168, 2, 188, 186, 26, 1, 16, 185, 170, 203, 26, 230, 10, 161,
+112, 145, 32, 138, 3, 40, 147, 32, 145, 83, 65, 50, 89, 23, 185, 19, 18, 3, 76,
+162, 191, 201, 11, 248, 191, 19, 41, 161, 60, 160, 65, 168, 38, 171, 1, 139, 2,
+40, 161, 48, 170, 101, 18, 2, 2, 170, 34, 10, 24, 248, 157, 145, 0, 6, 59, 26,
+160, 59, 252, 16, 128, 161, 159, 130, 64, 147, 26, 129, 42, 131, 129, 193, 13,
+51, 73, 67, 82, 4, 169, 64, 20, 168, 10, 52, 237, 154, 10, 240, 159, 131, 24,
+161, 43, 129, 64, 16, 19, 173, 145, 153, 51, 145, 9, 188, 90, 52, 33, 34, 162,
+72, 147, 82, 179, 172, 156, 152, 156, 136, 185, 158, 16, 49, 250, 29, 17, 49,
+128, 136, 40, 152, 115, 176, 137, 10, 4, 66, 5, 81, 160, 40, 64, 20, 137, 136,
+3, 236, 154, 192, 255, 60, 144, 32, 218, 32, 146, 0, 51, 176, 26, 136, 58, 67,
+187, 0, 207, 33, 20, 1, 0, 9, 84, 128, 35, 144, 187, 170, 137, 176, 174, 201,
+175, 16, 144, 0, 235, 60, 186, 9, 83, 20, 160, 88, 130, 26, 21, 155, 8, 136, 49,
+21, 98, 147, 26, 18, 99, 49, 152, 74, 224, 156, 136, 251, 191, 3, 9, 177, 13,
+35, 138, 65, 2, 11, 128, 40, 131, 130, 144, 251, 60, 20, 24, 130, 152, 50, 6,
+81, 2, 10, 186, 25, 168, 201, 188, 218, 154, 170, 8, 239, 41, 33, 34, 168, 40,
+21, 32, 35, 169, 173, 40, 36, 22, 153, 35, 10, 84, 33, 2, 170, 82, 176, 11, 233,
+255, 29, 129, 8, 184, 43, 131, 10, 83, 130, 11, 128, 65, 4, 128, 152, 233, 57,
+19, 17, 185, 140, 98, 18, 51, 145, 170, 9, 1, 83, 237, 138, 186, 9, 128, 202,
+237, 10, 51, 34, 144, 9, 0, 236, 57, 33, 68, 19, 152, 184, 11, 68, 49, 67, 5,
+184, 40, 55, 1, 145, 138, 152, 49, 153, 255, 255, 17, 137, 160, 139, 34, 136,
+32, 4, 138, 1, 33, 20, 2, 171, 144, 12, 53, 130, 187, 154, 114, 5, 32, 129, 137,
+24, 129, 48, 249, 142, 169, 10, 130, 189, 152, 173, 40, 66, 3, 170, 48, 68, 20,
+130, 153, 171, 68, 33, 0, 25, 37, 144, 66, 37, 2, 168, 10, 16, 157, 139, 255,
+207, 17, 144, 168, 170, 49, 128, 72, 20, 154, 16, 50, 36, 129, 169, 130, 171,
+55, 161, 152, 169, 57, 87, 144, 17, 128, 25, 16, 16, 232, 173, 137, 152, 169,
+220, 10, 236, 41, 21, 136, 153, 40, 38, 152, 49, 160, 0, 3, 60, 8, 33, 33, 18,
+140, 68, 1, 35, 169, 56, 21, 160, 25, 234, 219, 154, 249, 239, 8, 1, 152, 171,
+16, 18, 32, 34, 0, 128, 68, 21, 2, 138, 32, 154, 65, 0, 168, 187, 32, 87, 128,
+0, 1, 136, 114, 129, 154, 204, 138, 184, 186, 184, 221, 186, 157, 80, 35, 136,
+16, 24, 37, 2, 18, 1, 40, 115, 129, 72, 17, 2, 58, 7, 169, 24, 83, 160, 171, 44,
+132, 239, 201, 187, 16, 129, 202, 171, 40, 67, 16, 82, 145, 16, 53, 35, 131,
+169, 129, 154, 97, 146, 173, 154, 89, 36, 128, 2, 184, 50, 22, 144, 188, 9, 73,
+200, 157, 185, 168, 217, 205, 25, 50, 19, 0, 40, 85, 1, 0, 137, 0, 3, 54, 10,
+55, 145, 17, 128, 68, 144, 16, 203, 48, 71, 177, 171, 41, 99, 249, 155, 202,
+156, 16, 145, 169, 188, 72, 36, 0, 32, 1, 48, 69, 2, 2, 202, 24, 145, 56, 194,
+157, 8, 66, 19, 128, 184, 49, 134, 16, 161, 172, 173, 10, 234, 154, 186, 153,
+185, 207, 80, 18, 0, 161, 24, 55, 128, 17, 168, 74, 65, 0, 18, 129, 82, 20, 171,
+50, 136, 85, 192, 171, 64, 136, 175, 173, 153, 236, 24, 146, 153, 185, 64, 34,
+32, 48, 20, 137, 53, 5, 144, 152, 32, 161, 75, 2, 172, 172, 80, 20, 160, 153,
+36, 160, 26, 56, 200, 190, 154, 36, 202, 137, 169, 25, 200, 207, 48, 38, 145,
+169, 24, 37, 0, 7, 62, 128, 8, 145, 26, 68, 128, 40, 147, 65, 128, 73, 178, 210,
+178, 162, 42, 123, 12, 188, 191, 130, 254, 25, 130, 8, 184, 45, 34, 0, 33, 162,
+144, 52, 50, 33, 185, 42, 0, 28, 146, 221, 168, 0, 20, 138, 18, 9, 5, 25, 67,
+25, 221, 155, 128, 128, 234, 169, 176, 160, 145, 15, 80, 83, 200, 136, 17, 53,
+145, 25, 146, 170, 64, 51, 49, 219, 56, 81, 2, 170, 20, 178, 184, 175, 121, 4,
+235, 168, 153, 19, 223, 10, 49, 137, 136, 171, 51, 4, 19, 21, 128, 56, 1, 72, 5,
+171, 187, 155, 36, 164, 202, 144, 88, 17, 0, 17, 2, 169, 120, 2, 129, 249, 11,
+24, 202, 9, 170, 154, 204, 0, 233, 54, 173, 16, 54, 133, 168, 41, 81, 33, 9, 24,
+16, 177, 8, 181, 0, 148, 12, 35, 26, 202, 61, 70, 152, 154, 25, 23, 168, 137,
+154, 28, 254, 142, 18, 152, 129, 171, 49, 1, 82, 4, 153, 24, 50, 17, 1, 204, 9,
+202, 65, 163, 140, 153, 12, 52, 146, 49, 162, 13, 36, 8, 18, 205, 11, 144, 0,
+200, 170, 203, 57, 4, 137, 187, 115, 134, 9, 50, 35, 0, 155, 50, 241, 153, 67,
+153, 10, 10, 132, 146, 68, 137, 56, 72, 68, 193, 28, 18, 251, 16, 148, 170, 170,
+255, 47, 145, 0, 176, 138, 35, 8, 99, 129, 153, 8, 17, 33, 163, 188, 192, 155,
+84, 145, 139, 168, 43, 39, 129, 18, 176, 0, 10, 59, 40, 3, 138, 65, 235, 140,
+152, 154, 19, 161, 13, 170, 75, 149, 137, 39, 152, 58, 0, 65, 134, 185, 9, 0,
+44, 3, 233, 128, 130, 24, 37, 136, 3, 174, 112, 17, 137, 16, 169, 41, 204, 17,
+150, 177, 241, 207, 48, 8, 24, 233, 8, 2, 0, 20, 160, 136, 41, 64, 49, 170, 152,
+250, 138, 53, 128, 144, 172, 41, 36, 49, 129, 189, 40, 3, 49, 128, 202, 219,
+153, 68, 18, 187, 173, 170, 66, 129, 156, 64, 184, 16, 21, 49, 0, 159, 49, 145,
+144, 185, 64, 25, 72, 4, 184, 188, 72, 52, 136, 176, 202, 99, 18, 42, 34, 241,
+200, 152, 73, 81, 255, 27, 2, 128, 162, 187, 34, 144, 114, 1, 0, 253, 68, 153,
+25, 0, 16, 2, 152, 163, 175, 82, 3, 8, 160, 140, 98, 129, 16, 193, 138, 1, 42,
+51, 250, 153, 168, 11, 82, 202, 157, 184, 0, 4, 16, 3, 42, 67, 41, 53, 160, 234,
+49, 3, 141, 64, 128, 128, 1, 24, 34, 9, 152, 252, 64, 130, 50, 216, 44, 50, 191,
+49, 232, 129, 241, 175, 33, 136, 56, 217, 10, 3, 41, 36, 185, 24, 162, 82, 3,
+27, 17, 174, 64, 18, 24, 160, 156, 18, 3, 20, 192, 154, 24, 43, 84, 154, 144,
+222, 25, 3, 154, 186, 190, 137, 36, 21, 160, 153, 32, 98, 66, 13};
+
+#endif /* BURROUGHS1_18649_ADPCM_H_ */